@@ -0,0 +1,116 @@
+// AtMostOne.cpp
+// --------------
+// Greedy-Cliquensuche im Konfliktgraphen der Literale (Kanten aus Binärklauseln).
+// Für jedes Literal l startet an jeder noch nicht abgedeckten Kante (l, n0) eine
+// Clique {l, n0}; weitere Nachbarn von l werden aufgenommen, solange sie zu allen
+// bisherigen Mitgliedern adjazent sind (auch über bereits abgedeckte Kanten).
+// So entstehen bei Sudoku-Kodierungen volle Zellen-, Zeilen-, Spalten- und Blockcliquen.
+
+#include "AtMostOne.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_set>
+
+// Literal → Index: pos(x) -> 2x, neg(x) -> 2x+1
+static size_t litIndex(const Literal& l) {
+    return 2 * static_cast<size_t>(l.getVar()) + (l.isNegated() ? 1 : 0);
+}
+
+static Literal indexToLit(size_t idx) {
+    return Literal(static_cast<int>(idx / 2), (idx & 1) != 0);
+}
+
+// Ungerichtete Kante als 64-Bit-Schlüssel
+static uint64_t edgeKey(size_t a, size_t b) {
+    if (a > b) std::swap(a, b);
+    return (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b);
+}
+
+AtMostOneDetector::AtMostOneDetector(size_t minSize, uint64_t stepLimit)
+    : minSize{minSize}, stepLimit{stepLimit} {}
+
+AtMostOneDetector::Result AtMostOneDetector::extract(std::vector<Clause>& clauses, int numVars) const {
+    Result res;
+    const size_t N = 2 * static_cast<size_t>(numVars + 1);
+
+    // --- Konfliktgraph: (a ∨ b) → ¬a und ¬b sind nicht beide wahr ---
+    std::vector<std::vector<size_t>> adj(N);
+    for (const auto& c : clauses) {
+        if (c.size() != 2 || c.at(0).getVar() == c.at(1).getVar()) continue;
+        const size_t a = litIndex(c.at(0)) ^ 1U;
+        const size_t b = litIndex(c.at(1)) ^ 1U;
+        adj[a].push_back(b);
+        adj[b].push_back(a);
+    }
+    for (auto& a : adj) {
+        std::sort(a.begin(), a.end());
+        a.erase(std::unique(a.begin(), a.end()), a.end());
+    }
+
+    uint64_t steps = 0;
+    auto adjacent = [&](size_t a, size_t b) {
+        ++steps;
+        return std::binary_search(adj[a].begin(), adj[a].end(), b);
+    };
+
+    // --- Cliquen suchen ---
+    std::unordered_set<uint64_t> covered;
+    std::vector<size_t> clique;
+    for (size_t l = 0; l < N && steps < stepLimit; ++l) {
+        if (adj[l].size() + 1 < minSize) continue;
+        for (size_t n0 : adj[l]) {
+            if (steps >= stepLimit) break;
+            if (covered.count(edgeKey(l, n0))) continue;
+
+            // Start mit einer neuen Kante (l, n0), Erweiterung über alle Nachbarn von l
+            clique.assign({l, n0});
+            for (size_t n : adj[l]) {
+                if (n == n0) continue;
+                bool all = true;
+                for (size_t k = 1; k < clique.size() && all; ++k) all = adjacent(n, clique[k]);
+                if (all) clique.push_back(n);
+            }
+            if (clique.size() < minSize) continue;
+
+            for (size_t i = 0; i < clique.size(); ++i) {
+                for (size_t j = i + 1; j < clique.size(); ++j) covered.insert(edgeKey(clique[i], clique[j]));
+            }
+            std::vector<Literal> lits;
+            lits.reserve(clique.size());
+            for (size_t x : clique) lits.push_back(indexToLit(x));
+            res.constraints.push_back(std::move(lits));
+        }
+    }
+    if (res.constraints.empty()) return res;
+
+    // --- Exactly-One: ALO-Klausel über genau denselben Literalen ---
+    std::set<std::vector<size_t>> amoSets;
+    for (const auto& amo : res.constraints) {
+        std::vector<size_t> key;
+        for (const auto& l : amo) key.push_back(litIndex(l));
+        std::sort(key.begin(), key.end());
+        amoSets.insert(std::move(key));
+    }
+
+    // --- Abgedeckte Binärklauseln stabil entfernen ---
+    size_t j = 0;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        const Clause& c = clauses[i];
+        if (c.size() == 2 && c.at(0).getVar() != c.at(1).getVar()
+            && covered.count(edgeKey(litIndex(c.at(0)) ^ 1U, litIndex(c.at(1)) ^ 1U))) {
+            ++res.removedBinaries;
+            continue;
+        }
+        if (c.size() >= minSize) {
+            std::vector<size_t> key;
+            for (const auto& l : c.getClause()) key.push_back(litIndex(l));
+            std::sort(key.begin(), key.end());
+            if (amoSets.count(key)) ++res.exactlyOne;
+        }
+        if (i != j) clauses[j] = std::move(clauses[i]);
+        ++j;
+    }
+    clauses.erase(clauses.begin() + static_cast<std::ptrdiff_t>(j), clauses.end());
+    return res;
+}
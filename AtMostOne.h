@@ -0,0 +1,34 @@
+
+#ifndef ATMOSTONE_H
+#define ATMOSTONE_H
+
+#include <cstdint>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Erkennung von At-Most-One-Constraints in paarweisen Binärkodierungen.
+// Jede binäre Klausel (¬a ∨ ¬b) ist eine Kante "a und b nicht beide wahr" im
+// Konfliktgraphen der Literale. Greedy gefundene Cliquen ab minSize Literalen werden
+// als AMO-Constraint ausgegeben; die von ihnen abgedeckten Binärklauseln entfallen.
+class AtMostOneDetector {
+public:
+    struct Result {
+        std::vector<std::vector<Literal>> constraints; // höchstens eines der Literale ist wahr
+        size_t exactlyOne      = 0;                   // davon mit passender ALO-Klausel (Exactly-One)
+        size_t removedBinaries = 0;                   // #entfernter Binärklauseln
+    };
+
+    // minSize:   kleinste Cliquengröße (kleinere bleiben als Binärklauseln stehen)
+    // stepLimit: maximale Anzahl Adjazenztests (Laufzeitbudget)
+    explicit AtMostOneDetector(size_t minSize = 3, uint64_t stepLimit = 20'000'000);
+
+    // Cliquen suchen und die abgedeckten Binärklauseln aus 'clauses' entfernen
+    Result extract(std::vector<Clause>& clauses, int numVars) const;
+
+private:
+    size_t   minSize;
+    uint64_t stepLimit;
+};
+
+#endif // ATMOSTONE_H
@@ -0,0 +1,81 @@
+// Backbone.cpp
+// ------------
+// Kandidatenfilter über Modelle und blockweise Prüfung mit Aktivierungsliteralen.
+// Jede Aktivierungsvariable wird nach ihrem Block per Unit ¬a stillgelegt, ihre
+// Klausel ist damit auf Level 0 erfüllt.
+
+#include "Backbone.h"
+
+#include <algorithm>
+
+namespace {
+
+// Kandidaten streichen, deren Wert das Modell widerspricht
+uint64_t filterByModel(std::vector<Literal>& candidates, const std::vector<int>& model) {
+    const size_t before = candidates.size();
+    std::erase_if(candidates, [&](const Literal& l) {
+        return model[l.getVar()] != (l.isNegated() ? 0 : 1);
+    });
+    return before - candidates.size();
+}
+
+} // namespace
+
+Backbone::Result Backbone::compute(Solver& solver, int numVars) const {
+    Result res;
+    ++res.solves;
+    if (!solver.solve()) return res; // UNSAT (oder abgebrochen): kein Backbone
+    res.sat = true;
+
+    std::vector<Literal> candidates;
+    {
+        const std::vector<int> model = solver.getModel();
+        for (int v = 1; v <= numVars; ++v) {
+            if (model[v] != -1) candidates.emplace_back(v, model[v] == 0);
+        }
+    }
+
+    int nextVar = solver.getNumVars();
+    size_t chunk = 1;
+    while (!candidates.empty()) {
+        const size_t k = std::min(chunk, candidates.size());
+        const std::vector<Literal> block(candidates.end() - static_cast<std::ptrdiff_t>(k), candidates.end());
+
+        bool sat = false;
+        ++res.solves;
+        if (k == 1) {
+            // Einzelnes Literal: ¬l direkt annehmen, keine Hilfsvariable nötig
+            sat = solver.solve({Literal(block[0].getVar(), !block[0].isNegated())});
+        } else {
+            const Literal act(++nextVar, false);
+            std::vector<Literal> clause{Literal(act.getVar(), true)};
+            for (const auto& l : block) clause.emplace_back(l.getVar(), !l.isNegated());
+            solver.addInputClause(std::move(clause));
+            sat = solver.solve({act});
+            if (!sat && !solver.isInterrupted() && !solver.isFailedAssumption(act)) {
+                // Widerspruch ohne die Annahme: Formel selbst UNSAT (nur durch Abbruch denkbar)
+                return res;
+            }
+        }
+        if (solver.isInterrupted()) return res;
+        // Modell vor dem Stilllegen lesen (addInputClause springt auf Level 0 zurück)
+        if (sat) res.filtered += filterByModel(candidates, solver.getModel());
+        if (k > 1) solver.addInputClause({Literal(nextVar, true)});
+
+        if (sat) {
+            chunk = std::max<size_t>(1, chunk / 2);
+        } else {
+            candidates.resize(candidates.size() - k);
+            for (const auto& l : block) {
+                res.literals.push_back(l);
+                solver.addInputClause({l});
+            }
+            if (k > 1) ++res.chunks;
+            chunk = std::min(maxChunk, chunk * 2);
+        }
+    }
+
+    res.complete = true;
+    std::ranges::sort(res.literals, [](const Literal& a, const Literal& b) { return a.getVar() < b.getVar(); });
+    return res;
+}
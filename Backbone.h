@@ -0,0 +1,40 @@
+
+#ifndef BACKBONE_H
+#define BACKBONE_H
+
+#include <cstdint>
+#include <vector>
+#include "Literal.h"
+#include "Solver.h"
+
+// Backbone-Berechnung: Literale, die in jedem Modell wahr sind.
+// Ein einziger Solver bleibt über alle Aufrufe warm (gelernte Klauseln, Aktivitäten, Phasen).
+// Kandidaten sind die Literale des ersten Modells; jedes weitere Modell streicht alle
+// Kandidaten, deren Wert es widerspricht. Geprüft wird in Blöcken: eine Klausel
+// (¬a ∨ ¬l1 ∨ … ∨ ¬lk) mit frischer Aktivierungsvariable a wird unter der Annahme a gelöst.
+// UNSAT mit Kern {a} bestätigt alle k Literale auf einmal, SAT liefert ein neues Modell zum
+// Filtern. Die Blockgröße passt sich an (UNSAT: verdoppeln, SAT: halbieren).
+// Bestätigte Literale werden als Units hinzugefügt und stärken die folgenden Aufrufe.
+class Backbone {
+public:
+    struct Result {
+        bool sat = false;               // Formel erfüllbar (sonst gibt es kein Backbone)
+        bool complete = false;          // alle Kandidaten entschieden (nicht abgebrochen)
+        std::vector<Literal> literals;  // Backbone-Literale, nach Variable sortiert
+        uint64_t solves = 0;            // #solve()-Aufrufe
+        uint64_t chunks = 0;            // #auf einmal bestätigter Blöcke (UNSAT)
+        uint64_t filtered = 0;          // #Kandidaten, die durch Modelle gestrichen wurden
+    };
+
+    // maxChunk: größte Blockgröße (1 = jedes Literal einzeln prüfen)
+    explicit Backbone(size_t maxChunk = 64) : maxChunk{maxChunk == 0 ? 1 : maxChunk} {}
+
+    // Backbone über den Variablen 1..numVars des (noch ungelösten) Solvers berechnen.
+    // Der Solver erhält dabei zusätzliche Aktivierungsvariablen und Klauseln
+    Result compute(Solver& solver, int numVars) const;
+
+private:
+    size_t maxChunk;
+};
+
+#endif // BACKBONE_H
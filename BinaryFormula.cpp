@@ -0,0 +1,172 @@
+// BinaryFormula.cpp
+// -----------------
+// Lesen/Schreiben des .gcnf-Formats. Beim Öffnen werden Header, Größen und Offsets geprüft;
+// die Literale selbst werden beim Aufbau der Klauseln validiert.
+
+#include "BinaryFormula.h"
+
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr char     kMagic[8] = {'G', 'U', 'M', 'S', 'C', 'N', 'F', '1'};
+constexpr uint32_t kVersion  = 1;
+
+inline uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+} // namespace
+
+bool BinaryFormula::open(const std::filesystem::path& path) {
+    return file.open(path) && attach(file.data(), file.size());
+}
+
+bool BinaryFormula::attach(const char* data, size_t size) {
+    if (size < sizeof(Header)) return false;
+
+    hdr = reinterpret_cast<const Header*>(data);
+    if (std::memcmp(hdr->magic, kMagic, sizeof(kMagic)) != 0 || hdr->version != kVersion) return false;
+
+    // Größen müssen exakt zum Speicherbereich passen (ohne Überlauf bei beschädigtem Header:
+    // jeder Teil einzeln gegen den verfügbaren Platz prüfen)
+    if (hdr->numVars > static_cast<uint64_t>(INT32_MAX)) return false;
+    const uint64_t body = size - sizeof(Header);
+    if (hdr->numClauses >= body / sizeof(uint64_t)) return false;
+    const uint64_t offsetBytes = (hdr->numClauses + 1) * sizeof(uint64_t);
+    if (hdr->numLits > (body - offsetBytes) / sizeof(int32_t)) return false;
+    if (offsetBytes + hdr->numLits * sizeof(int32_t) != body) return false;
+
+    offsets = reinterpret_cast<const uint64_t*>(data + sizeof(Header));
+    lits    = reinterpret_cast<const int32_t*>(offsets + hdr->numClauses + 1);
+    if (offsets[0] != 0 || offsets[hdr->numClauses] != hdr->numLits) return false;
+
+    // Offsets monoton und innerhalb der Literale (decode() vertraut ihnen)
+    for (size_t i = 0; i < hdr->numClauses; ++i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > hdr->numLits) return false;
+    }
+    return true;
+}
+
+bool BinaryFormula::decode(std::vector<Clause>& out) const {
+    const int n = numVariables();
+    out.clear();
+    out.reserve(numClauses());
+    for (size_t i = 0; i < numClauses(); ++i) {
+        std::vector<Literal> clause;
+        clause.reserve(static_cast<size_t>(clauseEnd(i) - clauseBegin(i)));
+        for (const int32_t* p = clauseBegin(i); p != clauseEnd(i); ++p) {
+            if (*p == INT32_MIN) return false;  // beschädigte Daten (-*p nicht darstellbar)
+            const int v = *p < 0 ? -*p : *p;
+            if (v == 0 || v > n) return false;  // beschädigte Daten
+            clause.emplace_back(v, *p < 0);
+        }
+        Clause c(std::move(clause));
+        c.initWatchesDefault();
+        out.push_back(std::move(c));
+    }
+    return true;
+}
+
+bool BinaryFormula::isBinary(const std::filesystem::path& path) {
+    std::ifstream ifs{path, std::ios::binary};
+    char magic[sizeof(kMagic)] = {};
+    ifs.read(magic, sizeof(magic));
+    return ifs.gcount() == sizeof(magic) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool BinaryFormula::write(const std::filesystem::path& path, int numVars, const std::vector<Clause>& clauses,
+                          uint64_t sourceHash, uint64_t sourceSize) {
+    std::vector<uint64_t> offs;
+    offs.reserve(clauses.size() + 1);
+    offs.push_back(0);
+    for (const auto& c : clauses) offs.push_back(offs.back() + c.size());
+
+    std::vector<int32_t> flat;
+    flat.reserve(offs.back());
+    for (const auto& c : clauses) {
+        for (const auto& l : c.getClause()) flat.push_back(l.toInt());
+    }
+
+    Header h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version    = kVersion;
+    h.numVars    = static_cast<uint64_t>(numVars);
+    h.numClauses = clauses.size();
+    h.numLits    = flat.size();
+    h.sourceHash = sourceHash;
+    h.sourceSize = sourceSize;
+
+    std::filesystem::path tmp = path;
+    tmp += ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream ofs{tmp, std::ios::binary | std::ios::trunc};
+        if (!ofs.is_open()) return false;
+        ofs.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        ofs.write(reinterpret_cast<const char*>(offs.data()), static_cast<std::streamsize>(offs.size() * sizeof(uint64_t)));
+        ofs.write(reinterpret_cast<const char*>(flat.data()), static_cast<std::streamsize>(flat.size() * sizeof(int32_t)));
+        if (!ofs.good()) {
+            ofs.close();
+            std::filesystem::remove(tmp);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) std::filesystem::remove(tmp, ec);
+    return !ec;
+}
+
+size_t BinaryFormula::encodedSize(const std::vector<Clause>& clauses) {
+    size_t numLits = 0;
+    for (const auto& c : clauses) numLits += c.size();
+    return sizeof(Header) + (clauses.size() + 1) * sizeof(uint64_t) + numLits * sizeof(int32_t);
+}
+
+void BinaryFormula::encode(char* dst, int numVars, const std::vector<Clause>& clauses,
+                           uint64_t sourceHash, uint64_t sourceSize) {
+    Header h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version    = kVersion;
+    h.numVars    = static_cast<uint64_t>(numVars);
+    h.numClauses = clauses.size();
+    h.sourceHash = sourceHash;
+    h.sourceSize = sourceSize;
+
+    char* offs = dst + sizeof(Header);
+    char* out  = offs + (clauses.size() + 1) * sizeof(uint64_t);
+    uint64_t pos = 0;
+    for (size_t i = 0; i <= clauses.size(); ++i) {
+        std::memcpy(offs + i * sizeof(uint64_t), &pos, sizeof(pos));
+        if (i == clauses.size()) break;
+        for (const auto& l : clauses[i].getClause()) {
+            const int32_t x = l.toInt();
+            std::memcpy(out + pos * sizeof(int32_t), &x, sizeof(x));
+            ++pos;
+        }
+    }
+    h.numLits = pos;
+    std::memcpy(dst, &h, sizeof(h));
+}
+
+// 8 Byte pro Schritt; Rest byteweise. Länge geht mit ein.
+uint64_t BinaryFormula::contentHash(const char* data, size_t size) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (size * 0xC2B2AE3D27D4EB4FULL);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, data + i, 8);
+        h = (h ^ mix(w)) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+    }
+    uint64_t tail = 0;
+    for (size_t k = 0; i < size; ++i, ++k) tail |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (8 * k);
+    return mix(h ^ mix(tail + 1));
+}
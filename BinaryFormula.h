@@ -0,0 +1,70 @@
+
+#ifndef BINARYFORMULA_H
+#define BINARYFORMULA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Clause.h"
+#include "MappedFile.h"
+
+// Kompaktes Binärformat für Formeln (.gcnf), direkt per mmap lesbar:
+//   Header | uint64 offsets[numClauses + 1] | int32 lits[numLits]
+// Literale sind DIMACS-Zahlen (±Variable); Klausel i = lits[offsets[i] .. offsets[i+1]).
+// Der Header enthält einen Hash des Quelltexts, damit die Datei als Cache einer
+// CNF-Datei dienen kann (Schlüssel = Inhalt, nicht Pfad oder Zeitstempel).
+class BinaryFormula {
+public:
+    struct Header {
+        char     magic[8];     // "GUMSCNF1"
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t numVars;
+        uint64_t numClauses;
+        uint64_t numLits;
+        uint64_t sourceHash;   // contentHash() der Quelldatei (0 = unbekannt)
+        uint64_t sourceSize;   // Größe der Quelldatei in Bytes
+    };
+
+    // Datei einblenden und Header/Größen prüfen. false = kein (gültiges) Binärformat
+    bool open(const std::filesystem::path& path);
+
+    // Wie open(), aber auf einem fremden Speicherbereich (z. B. Shared Memory); der Bereich
+    // muss so lange gültig bleiben wie dieses Objekt benutzt wird
+    bool attach(const char* data, size_t size);
+
+    const Header& header() const { return *hdr; }
+    int           numVariables() const { return static_cast<int>(hdr->numVars); }
+    size_t        numClauses() const { return hdr->numClauses; }
+    const int32_t* clauseBegin(size_t i) const { return lits + offsets[i]; }
+    const int32_t* clauseEnd(size_t i) const { return lits + offsets[i + 1]; }
+
+    // Klauseln aufbauen (Watches initialisiert). false = Literal außerhalb des Variablenbereichs
+    bool decode(std::vector<Clause>& out) const;
+
+    // true, wenn die Datei mit der Magic-Zahl des Binärformats beginnt
+    static bool isBinary(const std::filesystem::path& path);
+
+    // Formel schreiben (über eine temporäre Datei + rename, damit parallele Läufe nie
+    // eine halbe Datei sehen). false = Schreibfehler
+    static bool write(const std::filesystem::path& path, int numVars, const std::vector<Clause>& clauses,
+                      uint64_t sourceHash, uint64_t sourceSize);
+
+    // Formel in einen Speicherbereich von encodedSize() Bytes schreiben (gleiches Layout wie write)
+    static size_t encodedSize(const std::vector<Clause>& clauses);
+    static void   encode(char* dst, int numVars, const std::vector<Clause>& clauses,
+                         uint64_t sourceHash, uint64_t sourceSize);
+
+    // Schneller, nicht-kryptographischer 64-Bit-Hash über einen Puffer
+    static uint64_t contentHash(const char* data, size_t size);
+
+private:
+    MappedFile     file;
+    const Header*  hdr     = nullptr;
+    const uint64_t* offsets = nullptr;
+    const int32_t* lits    = nullptr;
+};
+
+#endif // BINARYFORMULA_H
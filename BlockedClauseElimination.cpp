@@ -0,0 +1,95 @@
+// BlockedClauseElimination.cpp
+// -----------------------------
+// Blocked Clause Elimination über Occurrence-Listen (pro Literal).
+// Eine Warteschlange enthält nur Klauseln, die erneut geprüft werden müssen:
+// anfangs alle, danach nur Klauseln, die ein Resolutionspartner einer gerade
+// entfernten Klausel waren (nur für sie kann sich etwas geändert haben).
+
+#include "BlockedClauseElimination.h"
+
+#include <deque>
+
+// Literal → Index in die Occurrence-Listen: pos(x) -> 2x, neg(x) -> 2x+1
+static size_t litIndex(const Literal& l) {
+    return 2 * static_cast<size_t>(l.getVar()) + (l.isNegated() ? 1 : 0);
+}
+
+BlockedClauseElimination::BlockedClauseElimination(uint64_t stepLimit, size_t occLimit)
+    : stepLimit{stepLimit}, occLimit{occLimit} {}
+
+size_t BlockedClauseElimination::eliminate(std::vector<Clause>& clauses, int numVars,
+                                           Reconstruction& rec) const {
+    const size_t n = clauses.size();
+    std::vector<bool> removed(n, false);
+
+    // Occurrence-Listen aufbauen
+    std::vector<std::vector<size_t>> occ(2 * static_cast<size_t>(numVars + 1));
+    for (size_t i = 0; i < n; ++i) {
+        for (const auto& l : clauses[i].getClause()) occ[litIndex(l)].push_back(i);
+    }
+
+    std::deque<size_t> queue;
+    std::vector<bool> queued(n, true);
+    for (size_t i = 0; i < n; ++i) queue.push_back(i);
+
+    // Markierung der Literale der aktuell geprüften Klausel
+    std::vector<uint8_t> mark(occ.size(), 0);
+
+    uint64_t steps = 0;
+    size_t eliminated = 0;
+    while (!queue.empty() && steps < stepLimit) {
+        const size_t c = queue.front();
+        queue.pop_front();
+        queued[c] = false;
+        if (removed[c]) continue;
+
+        const auto& lits = clauses[c].getClause();
+        for (const auto& l : lits) mark[litIndex(l)] = 1;
+
+        // Blockierendes Literal suchen
+        int blockingPos = -1;
+        for (size_t p = 0; p < lits.size() && blockingPos == -1; ++p) {
+            const Literal& l = lits[p];
+            const auto& partners = occ[litIndex(Literal(l.getVar(), !l.isNegated()))];
+            if (partners.size() > occLimit) continue;
+
+            bool blocked = true;
+            for (size_t d : partners) {
+                if (removed[d]) continue;
+                ++steps;
+                // Resolvente tautologisch? → D enthält ¬k für ein k ∈ C \ {l}
+                bool tautology = false;
+                for (const auto& k : clauses[d].getClause()) {
+                    if (k.getVar() == l.getVar()) continue;
+                    if (mark[litIndex(Literal(k.getVar(), !k.isNegated()))]) { tautology = true; break; }
+                }
+                if (!tautology) { blocked = false; break; }
+            }
+            if (blocked) blockingPos = static_cast<int>(p);
+        }
+
+        for (const auto& l : lits) mark[litIndex(l)] = 0;
+        if (blockingPos == -1) continue;
+
+        // Klausel entfernen, Resolutionspartner erneut prüfen
+        const Literal pivot = lits[blockingPos];
+        removed[c] = true;
+        ++eliminated;
+        rec.push(pivot, lits);
+        for (const auto& l : lits) {
+            for (size_t d : occ[litIndex(Literal(l.getVar(), !l.isNegated()))]) {
+                if (!removed[d] && !queued[d]) { queue.push_back(d); queued[d] = true; }
+            }
+        }
+    }
+
+    // Entfernte Klauseln stabil aus dem Vektor löschen
+    size_t j = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (removed[i]) continue;
+        if (i != j) clauses[j] = std::move(clauses[i]);
+        ++j;
+    }
+    clauses.erase(clauses.begin() + static_cast<std::ptrdiff_t>(j), clauses.end());
+    return eliminated;
+}
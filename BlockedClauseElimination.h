@@ -0,0 +1,29 @@
+
+#ifndef BLOCKEDCLAUSEELIMINATION_H
+#define BLOCKEDCLAUSEELIMINATION_H
+
+#include <cstdint>
+#include <vector>
+#include "Clause.h"
+#include "Reconstruction.h"
+
+// Blocked Clause Elimination (BCE) als optionale Vorverarbeitung.
+// Eine Klausel C ist auf l ∈ C blockiert, wenn jede Resolvente mit einer Klausel,
+// die ¬l enthält, tautologisch ist. Blockierte Klauseln werden entfernt und mit
+// Pivot l für die Modell-Rekonstruktion gespeichert.
+class BlockedClauseElimination {
+public:
+    // stepLimit: maximale Anzahl geprüfter Resolutionspartner (Laufzeitbudget)
+    // occLimit:  Literale mit mehr Resolutionspartnern werden nicht als Pivot geprüft
+    explicit BlockedClauseElimination(uint64_t stepLimit = 50'000'000, size_t occLimit = 200);
+
+    // Entfernt blockierte Klauseln aus 'clauses' und legt sie auf 'rec'.
+    // Rückgabe: Anzahl entfernter Klauseln
+    size_t eliminate(std::vector<Clause>& clauses, int numVars, Reconstruction& rec) const;
+
+private:
+    uint64_t stepLimit;
+    size_t   occLimit;
+};
+
+#endif // BLOCKEDCLAUSEELIMINATION_H
@@ -3,113 +3,400 @@
 // Liest eine DIMACS-CNF-Datei ein und baut daraus Klausel-Objekte auf.
 // Unterstützt Kommentare (Zeilen mit 'c') und den Header "p cnf <vars> <clauses>".
 // Jede Klausel endet in der Datei mit einer 0.
+// Die Datei wird per mmap eingeblendet und direkt im Puffer gescannt: Literale landen
+// ohne Zwischen-Strings in einem flachen Puffer, erst am Ende entstehen die Klauseln.
+// Komprimierte Dateien (gzip/xz/bzip2) und stdin ("-") werden blockweise aus einem
+// Dekompressions-Thread gelesen; gescannt wird jeweils bis zum letzten Zeilenende eines
+// Blocks, der Rest wird dem nächsten Block vorangestellt.
+// Große unkomprimierte Dateien werden an Klauselgrenzen geteilt und parallel gescannt;
+// ein "0"-Token außerhalb von Kommentar-/Header-Zeilen beendet in DIMACS immer eine Klausel.
 
 #include "CNFParser.h"
+#include "BinaryFormula.h"
+#include "MappedFile.h"
+#include "StreamReader.h"
 
-#include <fstream>
-#include <string>
-#include <iostream>
-#include <sstream>
-#include <set>
 #include <algorithm>
-#include <limits>
+#include <climits>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
 
-// Pfad speichern
-CNFParser::CNFParser(const std::string_view path) : path{path} {}
+namespace {
 
-bool CNFParser::readFile() {
-    std::cout << "Datei einlesen..." << std::flush;
+// Zustand des Scanners (flacher Klauselpuffer + Header)
+struct ScanState {
+    std::vector<Literal> lits;          // Literale aller Klauseln hintereinander
+    std::vector<size_t>  offsets{0};    // Klausel i = lits[offsets[i] .. offsets[i+1])
+    int  maxVar        = 0;             // größte gelesene Variable
+    int  headerVars    = 0;             // Anzahl Variablen laut Header
+    int  headerClauses = 0;             // Anzahl Klauseln laut Header
+    bool header        = false;         // Header gelesen
+    std::string error;                  // nicht leer = Syntaxfehler
+};
 
-    std::ifstream ifs{this->path};
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
 
-    // Datei lässt sich nicht öffnen -> Fehler
-    if (!ifs.is_open()) {
-        std::cerr << "Fehler: Datei konnte nicht geöffnet werden! Pfad: "
-                  << this->path << std::endl;
-        return false;
-    }
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') <= 9;
+}
 
-    // Laufende Zähler und Puffer
-    int clauseCount = 0;     // tatsächlich gelesene Klauseln
-    std::set<int> varsCount; // Menge der vorkommenden Variablen-IDs (zur Plausibilitätsprüfung)
-    int numVars    = 0;      // Anzahl Variablen laut Header
-    int numClauses = 0;      // Anzahl Klauseln laut Header
+inline const char* skipLine(const char* p, const char* end) {
+    while (p < end && *p != '\n') ++p;
+    return p;
+}
 
-    std::string tok;                   // aktuelles Token
-    std::vector<Literal> current;      // sammelt Literale bis zur "0" (Ende der Klausel)
+// Vorzeichenbehaftete Dezimalzahl ab p lesen. nullptr = kein gültiges Token / Überlauf
+inline const char* scanInt(const char* p, const char* end, int& out) {
+    const bool neg = (p < end && *p == '-');
+    p += neg;
+    if (p == end || !isDigit(*p)) return nullptr;
+
+    uint64_t v = 0;
+    do {
+        v = v * 10 + static_cast<unsigned>(*p - '0');
+        if (v > static_cast<uint64_t>(INT_MAX)) return nullptr;
+        ++p;
+    } while (p < end && isDigit(*p));
+
+    if (p < end && !isSpace(*p)) return nullptr;  // z. B. "12x"
+    out = neg ? -static_cast<int>(v) : static_cast<int>(v);
+    return p;
+}
+
+// Header "p cnf <vars> <clauses>" (p zeigt auf 'p')
+const char* scanHeader(const char* p, const char* end, ScanState& st) {
+    const char* eol = skipLine(p, end);
+    p += 1;
+    while (p < eol && isSpace(*p)) ++p;
+    if (eol - p < 3 || p[0] != 'c' || p[1] != 'n' || p[2] != 'f') {
+        st.error = "Ungültiger Header";
+        return nullptr;
+    }
+    p += 3;
+    int vals[2] = {0, 0};
+    for (int& v : vals) {
+        while (p < eol && isSpace(*p)) ++p;
+        p = scanInt(p, eol, v);
+        if (p == nullptr || v < 0) {
+            st.error = "Ungültiger Header";
+            return nullptr;
+        }
+    }
+    st.header        = true;
+    st.headerVars    = vals[0];
+    st.headerClauses = vals[1];
+    return eol;  // Rest der Zeile ignorieren
+}
+
+// Puffer [p, end) scannen. Eine am Ende offene Klausel bleibt in st.lits stehen.
+bool scanDimacs(const char* p, const char* end, ScanState& st) {
+    while (p < end) {
+        // Whitespace überspringen
+        if (isSpace(*p)) { ++p; continue; }
 
-    // Haupt-Lese-Schleife: tokenweise
-    while (ifs >> tok) {
         // Kommentarzeile: alles bis Zeilenende ignorieren
-        if (!tok.empty() && tok[0] == 'c') {
-            ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        if (*p == 'c') { p = skipLine(p, end); continue; }
+
+        // Header-Zeile
+        if (*p == 'p') {
+            p = scanHeader(p, end, st);
+            if (p == nullptr) return false;
             continue;
         }
 
-        // Header-Zeile: "p cnf <numVars> <numClauses>"
-        if (!tok.empty() && tok[0] == 'p') {
-            std::string cnf;
-            ifs >> cnf >> numVars >> numClauses;
-            // Rest der Zeile ignorieren, falls noch was kommt
-            ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        int lit = 0;
+        const char* next = scanInt(p, end, lit);
+        if (next == nullptr) {
+            st.error = "Ungültiges Token \"" + std::string(p, skipLine(p, end) - p).substr(0, 32) + "\"";
+            return false;
+        }
+        p = next;
+
+        // 0 = Klauselabschluss (leere Klauseln werden wie bisher übergangen)
+        if (lit == 0) {
+            if (st.lits.size() != st.offsets.back()) st.offsets.push_back(st.lits.size());
             continue;
         }
 
-        // Ab hier erwarten wir Integer-Tokens (Literal oder 0)
-        int lit = std::stoi(tok);
+        // Normales Literal: Vorzeichen = Negation, Betrag = Variable
+        const int v = lit < 0 ? -lit : lit;
+        st.lits.emplace_back(v, lit < 0);
+        if (v > st.maxVar) st.maxVar = v;
+    }
+    return true;
+}
 
-        // 0 = Klauselabschluss -> Klausel fertigstellen und speichern
-        if (lit == 0) {
-            if (!current.empty()) {
-                Clause clause(std::move(current));
-                clause.initWatchesDefault();           // Standard-Watches setzen
-                this->clauses.push_back(std::move(clause));
-                ++clauseCount;
-                current.clear();                       // Puffer leeren für die nächste Klausel
+// Position hinter dem ersten klauselabschließenden "0"-Token ab p (p steht am Zeilenanfang).
+// Kommentar- und Header-Zeilen werden wie in scanDimacs übersprungen.
+const char* findClauseBoundary(const char* p, const char* end) {
+    while (p < end) {
+        if (isSpace(*p)) { ++p; continue; }
+        if (*p == 'c' || *p == 'p') { p = skipLine(p, end); continue; }
+        const char* tok = p;
+        while (p < end && !isSpace(*p)) ++p;
+        if (p - tok == 1 && *tok == '0') return p;
+    }
+    return end;
+}
+
+// Unkomprimierte Datei: per mmap einblenden. Große Dateien werden an Klauselgrenzen in
+// 'threads' Abschnitte geteilt und parallel gescannt (ein ScanState pro Abschnitt).
+bool scanMapped(const std::filesystem::path& path, std::vector<ScanState>& chunks, unsigned threads) {
+    MappedFile file;
+
+    // Datei lässt sich nicht öffnen -> Fehler
+    if (!file.open(path)) {
+        std::cerr << "Fehler: Datei konnte nicht geöffnet werden! Pfad: " << path << std::endl;
+        return false;
+    }
+
+    const char* begin = file.data();
+    const char* end   = begin + file.size();
+    constexpr size_t minChunkBytes = size_t{4} << 20;
+    threads = static_cast<unsigned>(std::clamp<size_t>(file.size() / minChunkBytes, 1, threads));
+
+    // Abschnittsgrenzen: ab der Sollposition zum nächsten Zeilenanfang, dann hinter die nächste "0"
+    std::vector<const char*> bounds{begin};
+    for (unsigned k = 1; k < threads; ++k) {
+        const char* p = begin + file.size() / threads * k;
+        p = std::max(skipLine(p, end), bounds.back());
+        bounds.push_back(findClauseBoundary(p, end));
+    }
+    bounds.push_back(end);
+
+    chunks.assign(threads, ScanState{});
+    auto scanChunk = [&](unsigned k) {
+        chunks[k].lits.reserve(static_cast<size_t>(bounds[k + 1] - bounds[k]) / 3);  // grobe Schätzung: >= 3 Bytes pro Literal
+        scanDimacs(bounds[k], bounds[k + 1], chunks[k]);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned k = 1; k < threads; ++k) {
+        pool.emplace_back(scanChunk, k);
+    }
+    scanChunk(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+
+    for (const auto& st : chunks) {
+        if (!st.error.empty()) {
+            std::cerr << "Fehler beim Parsen: " << st.error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Komprimierte Datei oder stdin: Blöcke aus dem Lese-Thread zeilenweise scannen
+bool scanStream(const std::filesystem::path& path, std::vector<ScanState>& chunks) {
+    chunks.assign(1, ScanState{});
+    ScanState& st = chunks.front();
+    StreamReader reader;
+    if (!reader.open(path)) {
+        std::cerr << "Fehler: Datei konnte nicht geöffnet werden! Pfad: " << path << std::endl;
+        return false;
+    }
+
+    // Obergrenze für eine einzelne Zeile (64 Blöcke à 1 MiB): Eingaben ohne Zeilenende
+    // werden nicht unbegrenzt im Speicher gesammelt
+    constexpr size_t maxCarryBytes = size_t{64} << 20;
+
+    std::vector<char> chunk;
+    std::vector<char> carry;  // unvollständige letzte Zeile des vorigen Blocks
+    while (reader.next(chunk)) {
+        const auto lastNl = std::find(chunk.rbegin(), chunk.rend(), '\n');
+        if (lastNl == chunk.rend()) {
+            carry.insert(carry.end(), chunk.begin(), chunk.end());
+            if (carry.size() > maxCarryBytes) {
+                std::cerr << "Fehler beim Parsen: Zeile länger als " << (maxCarryBytes >> 20)
+                          << " MiB ohne Zeilenende (" << path << ")" << std::endl;
+                return false;
             }
             continue;
         }
+        const auto split = lastNl.base();  // hinter dem letzten '\n'
 
-        // Normales Literal: Vorzeichen = Negation, Betrag = Variable
-        int  v   = std::abs(lit);
-        bool neg = (lit < 0);
-        current.emplace_back(v, neg);
-        varsCount.insert(v); // für Plausibilitätscheck (maxVarSeen)
+        bool ok;
+        if (carry.empty()) {
+            ok = scanDimacs(chunk.data(), chunk.data() + (split - chunk.begin()), st);
+        } else {
+            carry.insert(carry.end(), chunk.begin(), split);
+            ok = scanDimacs(carry.data(), carry.data() + carry.size(), st);
+        }
+        if (!ok) {
+            std::cerr << "Fehler beim Parsen: " << st.error << std::endl;
+            return false;
+        }
+        carry.assign(split, chunk.end());
+    }
+
+    const std::string error = reader.error();
+    if (!error.empty()) {
+        std::cerr << "Fehler beim Lesen: " << error << " (" << path << ")" << std::endl;
+        return false;
+    }
+    if (!scanDimacs(carry.data(), carry.data() + carry.size(), st)) {
+        std::cerr << "Fehler beim Parsen: " << st.error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Formel aus dem Binärformat übernehmen. expectedHash != 0: nur bei passendem Quell-Hash
+bool loadBinary(const std::filesystem::path& file, uint64_t expectedHash, uint64_t expectedSize,
+                std::vector<Clause>& clauses, int& numVars) {
+    BinaryFormula bin;
+    if (!bin.open(file)) return false;
+    if (expectedHash != 0
+        && (bin.header().sourceHash != expectedHash || bin.header().sourceSize != expectedSize)) {
+        return false;
+    }
+
+    std::vector<Clause> out;
+    if (!bin.decode(out)) return false;  // beschädigte Datei
+    clauses = std::move(out);
+    numVars = bin.numVariables();
+    return true;
+}
+
+std::string toHex(uint64_t x) {
+    static const char* digits = "0123456789abcdef";
+    std::string s(16, '0');
+    for (int i = 15; i >= 0; --i, x >>= 4) s[i] = digits[x & 0xF];
+    return s;
+}
+
+} // namespace
+
+// Pfad speichern
+CNFParser::CNFParser(const std::string_view path) : path{path} {}
+
+void CNFParser::setNumThreads(unsigned n) {
+    this->numThreads = n;
+}
+
+void CNFParser::setCacheDir(const std::filesystem::path& dir) {
+    this->cacheDir = dir;
+}
+
+bool CNFParser::readFile() {
+    std::cout << "Datei einlesen..." << std::flush;
+
+    // Binärformat direkt laden
+    if (this->path != "-" && BinaryFormula::isBinary(this->path)) {
+        if (!loadBinary(this->path, 0, 0, this->clauses, this->numVariables)) {
+            std::cerr << "Fehler: Ungültige Binärdatei: " << this->path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // Cache: Schlüssel ist der Hash des Dateiinhalts
+    std::filesystem::path cacheFile;
+    uint64_t sourceHash = 0, sourceSize = 0;
+    if (!this->cacheDir.empty() && this->path != "-") {
+        MappedFile source;
+        if (source.open(this->path)) {
+            sourceHash = BinaryFormula::contentHash(source.data(), source.size());
+            sourceSize = source.size();
+            cacheFile  = this->cacheDir / (toHex(sourceHash) + ".gcnf");
+            std::error_code ec;
+            if (std::filesystem::exists(cacheFile, ec)
+                && loadBinary(cacheFile, sourceHash, sourceSize, this->clauses, this->numVariables)) {
+                std::cout << " (Cache: " << cacheFile.filename().string() << ")" << std::flush;
+                return true;
+            }
+        }
+    }
+
+    std::vector<ScanState> chunks;
+    const bool streamed = this->path == "-"
+                          || StreamReader::detect(this->path) != StreamReader::Format::PLAIN;
+    const unsigned threads = numThreads != 0 ? numThreads : std::max(1U, std::thread::hardware_concurrency());
+    if (!(streamed ? scanStream(this->path, chunks) : scanMapped(this->path, chunks, threads))) {
+        return false;
+    }
+
+    // Abschnitte zusammenführen (Abschnitte enden an Klauselgrenzen, nur der letzte kann offen sein)
+    int    maxVar = 0, headerVars = 0, headerClauses = 0;
+    size_t clauseCount = 0;
+    for (const auto& st : chunks) {
+        maxVar = std::max(maxVar, st.maxVar);
+        clauseCount += st.offsets.size() - 1;
+        if (st.header) {
+            headerVars    = st.headerVars;
+            headerClauses = st.headerClauses;
+        }
     }
 
     // Dateiende erreicht:
     // Falls die letzte Klausel NICHT mit 0 abgeschlossen wurde, verwerfen wir sie (optional warnen)
-    if (!current.empty()) {
+    ScanState& last = chunks.back();
+    if (last.lits.size() != last.offsets.back()) {
         std::cerr << "Warnung: Letzte Klausel endete nicht mit 0 und wurde ignoriert.\n";
-        current.clear();
+        last.lits.resize(last.offsets.back());
     }
 
-    // Maximale tatsächlich verwendete Variable bestimmen (zur Plausibilitätsprüfung)
-    int maxVarSeen = varsCount.empty() ? 0 : *std::ranges::max_element(varsCount);
-
     // Plausibilitätscheck der Variablenanzahl:
     //  - DIMACS erlaubt, dass im Header mehr Variablen angegeben sind als genutzt
     //  - Fehler nur, wenn keine Variable gelesen wurde oder maxVarSeen > numVars
-    if (varsCount.empty() || maxVarSeen > numVars) {
+    if (maxVar == 0 || maxVar > headerVars) {
         std::cerr << "Variablen stimmen nicht überein!\n"
-                     "Max gefundene Variable: " << maxVarSeen
-                  << ", Header (deklarierte Variablen): " << numVars << std::endl;
-        this->clauses.clear();
+                     "Max gefundene Variable: " << maxVar
+                  << ", Header (deklarierte Variablen): " << headerVars << std::endl;
         return false;
     }
 
     // Für nachgelagerte Strukturen zählt die Header-Angabe
-    this->numVariables = numVars;
+    this->numVariables = headerVars;
 
     // Plausibilitätscheck der Klauselanzahl
-    if (clauseCount != numClauses) {
+    if (clauseCount != static_cast<size_t>(headerClauses)) {
         std::cerr << "Anzahl der Klauseln stimmen nicht überein!\n"
-                     "Angegebene Klauseln: " << numClauses
+                     "Angegebene Klauseln: " << headerClauses
                   << ", Tatsächliche Klauseln: " << clauseCount << std::endl;
-        this->clauses.clear();
         return false;
     }
 
+    // Klauseln aus den flachen Puffern aufbauen (je Abschnitt ein Thread), dann anhängen
+    std::vector<std::vector<Clause>> parts(chunks.size());
+    auto buildPart = [&](size_t k) {
+        const ScanState& st = chunks[k];
+        parts[k].reserve(st.offsets.size() - 1);
+        for (size_t i = 0; i + 1 < st.offsets.size(); ++i) {
+            Clause clause(std::vector<Literal>(st.lits.begin() + static_cast<std::ptrdiff_t>(st.offsets[i]),
+                                               st.lits.begin() + static_cast<std::ptrdiff_t>(st.offsets[i + 1])));
+            clause.initWatchesDefault();           // Standard-Watches setzen
+            parts[k].push_back(std::move(clause));
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t k = 1; k < chunks.size(); ++k) {
+        pool.emplace_back(buildPart, k);
+    }
+    buildPart(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+
+    this->clauses.reserve(clauseCount);
+    for (auto& part : parts) {
+        std::move(part.begin(), part.end(), std::back_inserter(this->clauses));
+    }
+
+    // Binär-Cache für den nächsten Lauf anlegen
+    if (!cacheFile.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(this->cacheDir, ec);
+        if (!BinaryFormula::write(cacheFile, this->numVariables, this->clauses, sourceHash, sourceSize)) {
+            std::cerr << "Warnung: Cache-Datei konnte nicht geschrieben werden: " << cacheFile << "\n";
+        }
+    }
+
     return true;
 }
 
@@ -121,4 +408,4 @@ std::vector<Clause>& CNFParser::getClauses() {
 // Anzahl der Variablen liefern (aus dem Header)
 int CNFParser::getNumVariables() const {
     return this->numVariables;
-}
\ No newline at end of file
+}
@@ -20,11 +20,26 @@ private:
     // Anzahl der in der Datei deklarierten Variablen
     int numVariables{};
 
+    // Threads für das Parsen großer unkomprimierter Dateien (0 = Anzahl Hardware-Threads)
+    unsigned numThreads{};
+
+    // Verzeichnis für den Binär-Cache (leer = kein Cache)
+    std::filesystem::path cacheDir;
+
 public:
     // Konstruktor mit Dateipfad
     explicit CNFParser(const std::string_view path);
 
-    // Liest die Datei und baut die Klauseln auf
+    // Anzahl Parser-Threads setzen (0 = automatisch)
+    void setNumThreads(unsigned n);
+
+    // Binär-Cache aktivieren: geparste Formeln werden unter <dir>/<Inhalts-Hash>.gcnf
+    // abgelegt und bei gleichem Dateiinhalt direkt von dort geladen
+    void setCacheDir(const std::filesystem::path& dir);
+
+    // Liest die Datei und baut die Klauseln auf.
+    // gzip/xz/bzip2 werden am Dateiinhalt erkannt und gestreamt dekomprimiert; "-" = stdin.
+    // Dateien im Binärformat (.gcnf, siehe BinaryFormula) werden direkt geladen
     bool readFile();
 
     // Zugriff auf die eingelesenen Klauseln
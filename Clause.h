@@ -29,6 +29,12 @@ private:
     // true, wenn diese Klausel gelernt wurde (nicht aus der Eingabe stammt)
     bool learnt = false;
 
+    // true, wenn die Klausel bereits vivifiziert wurde (nicht erneut versuchen)
+    bool vivified = false;
+
+    // true, wenn die Klausel bereits als Kandidat der Learnt-Subsumption geprüft wurde
+    bool subsumeChecked = false;
+
 public:
     // Konstruktor: nimmt die Literale der Klausel entgegen (optional leer)
     explicit Clause(std::vector<Literal> cla = {});
@@ -83,6 +89,22 @@ public:
     void setLearnt(bool v) {
         learnt = v;
     }
+
+    // Vivifikations-Flag lesen/setzen
+    bool isVivified() const {
+        return vivified;
+    }
+    void setVivified(bool v) {
+        vivified = v;
+    }
+
+    // Subsumptions-Flag lesen/setzen
+    bool isSubsumeChecked() const {
+        return subsumeChecked;
+    }
+    void setSubsumeChecked(bool v) {
+        subsumeChecked = v;
+    }
 };
 
 #endif // CLAUSE_H
\ No newline at end of file
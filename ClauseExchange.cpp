@@ -0,0 +1,68 @@
+// ClauseExchange.cpp
+// ------------------
+// Seqlock-Ringpuffer: der Schreiber markiert einen Slot als "in Arbeit", schreibt die Daten
+// und gibt ihn mit der neuen Sequenznummer frei. Der Leser kopiert die Daten und prüft danach,
+// ob sich die Sequenznummer nicht geändert hat; sonst wurde der Slot inzwischen überschrieben.
+
+#include "ClauseExchange.h"
+
+#include <algorithm>
+#include <bit>
+
+ClauseExchange::ClauseExchange(size_t numWorkers, size_t capacity)
+    : mask{std::bit_ceil(std::max<size_t>(capacity, 2)) - 1},
+      queues(numWorkers),
+      cursors(numWorkers * numWorkers, 0) {
+    for (auto& q : queues) {
+        q.slots = std::make_unique<Slot[]>(mask + 1);
+    }
+}
+
+void ClauseExchange::publish(size_t from, const int32_t* lits, size_t size, int lbd) {
+    if (size > kMaxSize) return;
+    Queue& q = queues[from];
+    const uint64_t pos = q.head.load(std::memory_order_relaxed);
+    Slot& s = q.slots[pos & mask];
+
+    s.seq.store(2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s.lbd.store(lbd, std::memory_order_relaxed);
+    s.size.store(static_cast<int32_t>(size), std::memory_order_relaxed);
+    for (size_t i = 0; i < size; ++i) {
+        s.lits[i].store(lits[i], std::memory_order_relaxed);
+    }
+    s.seq.store(2 * pos + 2, std::memory_order_release);
+    q.head.store(pos + 1, std::memory_order_release);
+}
+
+size_t ClauseExchange::collect(size_t to, std::vector<SharedClause>& out) {
+    const size_t n = queues.size();
+    size_t read = 0;
+    for (size_t from = 0; from < n; ++from) {
+        if (from == to) continue;
+        Queue& q = queues[from];
+        uint64_t& cur = cursors[to * n + from];
+        const uint64_t head = q.head.load(std::memory_order_acquire);
+        if (head - cur > mask + 1) cur = head - (mask + 1); // Überholt: Älteste sind verloren
+
+        for (; cur < head; ++cur) {
+            const Slot& s = q.slots[cur & mask];
+            const uint64_t expected = 2 * cur + 2;
+            if (s.seq.load(std::memory_order_acquire) != expected) continue;
+
+            SharedClause c;
+            c.lbd  = s.lbd.load(std::memory_order_relaxed);
+            c.size = s.size.load(std::memory_order_relaxed);
+            if (c.size < 0 || c.size > static_cast<int>(kMaxSize)) continue;
+            for (int i = 0; i < c.size; ++i) {
+                c.lits[i] = s.lits[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.seq.load(std::memory_order_relaxed) != expected) continue; // währenddessen überschrieben
+
+            out.push_back(c);
+            ++read;
+        }
+    }
+    return read;
+}
@@ -0,0 +1,59 @@
+
+#ifndef CLAUSEEXCHANGE_H
+#define CLAUSEEXCHANGE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Austausch gelernter Klauseln zwischen parallelen Workern.
+// Jeder Worker hat eine eigene ausgehende Queue (Ringpuffer fester Größe), in die nur er
+// schreibt; alle anderen lesen mit eigenem Cursor daraus. Es gibt keine Locks: jeder Slot ist
+// durch eine Sequenznummer geschützt (Seqlock). Ist ein Leser zu langsam, überschreibt der
+// Schreiber die ältesten Einträge – diese Klauseln gehen dem Leser verloren (unkritisch,
+// geteilte Klauseln sind nur Hinweise).
+class ClauseExchange {
+public:
+    static constexpr size_t kMaxSize = 8; // längere Klauseln werden nie geteilt
+
+    struct SharedClause {
+        int                              lbd  = 0;
+        int                              size = 0;
+        std::array<int32_t, kMaxSize>    lits{};   // DIMACS-Literale
+    };
+
+    // capacity wird auf eine Zweierpotenz aufgerundet
+    explicit ClauseExchange(size_t numWorkers, size_t capacity = 4096);
+
+    size_t numWorkers() const { return queues.size(); }
+
+    // Klausel in die Queue von Worker 'from' schreiben (nur von diesem Worker aufrufen).
+    // Klauseln mit mehr als kMaxSize Literalen werden ignoriert
+    void publish(size_t from, const int32_t* lits, size_t size, int lbd);
+
+    // Alle seit dem letzten Aufruf neuen Klauseln der anderen Worker an 'out' anhängen
+    // (nur von Worker 'to' aufrufen). Rückgabe: Anzahl gelesener Klauseln
+    size_t collect(size_t to, std::vector<SharedClause>& out);
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq{0};   // 2*pos+1 = wird geschrieben, 2*pos+2 = gültig für pos
+        std::atomic<int32_t>  lbd{0};
+        std::atomic<int32_t>  size{0};
+        std::array<std::atomic<int32_t>, kMaxSize> lits{};
+    };
+
+    struct alignas(64) Queue {
+        std::atomic<uint64_t>   head{0};  // nächste Schreibposition
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    size_t mask;
+    std::vector<Queue>    queues;
+    std::vector<uint64_t> cursors; // cursors[to * n + from]: nächste Leseposition (nur Worker 'to')
+};
+
+#endif // CLAUSEEXCHANGE_H
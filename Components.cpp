@@ -0,0 +1,169 @@
+// Components.cpp
+// ---------------
+// Root-Level-Propagation über Zähler (nicht-falsche Literale je Klausel) und
+// anschließend Union-Find über die Variablen jeder verbleibenden Klausel.
+
+#include "Components.h"
+
+#include <algorithm>
+#include <numeric>
+
+// Literal → Index: pos(x) -> 2x, neg(x) -> 2x+1
+static size_t litIndex(const Literal& l) {
+    return 2 * static_cast<size_t>(l.getVar()) + (l.isNegated() ? 1 : 0);
+}
+
+static int findRoot(std::vector<int>& parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+ComponentSplitter::Result ComponentSplitter::split(const std::vector<Clause>& clauses,
+                                                   const std::vector<std::vector<Literal>>& amos,
+                                                   int numVars) const {
+    Result res;
+    res.fixed.assign(numVars + 1, -1);
+    auto& value = res.fixed;
+
+    auto litValue = [&](const Literal& l) {
+        const int a = value[l.getVar()];
+        return a == -1 ? -1 : ((a == 1) != l.isNegated() ? 1 : 0);
+    };
+
+    // --- Occurrence-Listen und Zähler ---
+    const size_t N = 2 * static_cast<size_t>(numVars + 1);
+    std::vector<std::vector<size_t>> occ(N), amoOcc(N);
+    std::vector<int>  open(clauses.size());     // #nicht-falscher Literale
+    std::vector<bool> satisfied(clauses.size(), false);
+    std::vector<Literal> queue;
+
+    auto enqueue = [&](const Literal& l) {
+        const int v = litValue(l);
+        if (v == 0) return false;
+        if (v == -1) {
+            value[l.getVar()] = l.isNegated() ? 0 : 1;
+            queue.push_back(l);
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        const auto& lits = clauses[i].getClause();
+        if (lits.empty()) { res.unsat = true; return res; }
+        open[i] = static_cast<int>(lits.size());
+        for (const auto& l : lits) occ[litIndex(l)].push_back(i);
+    }
+    for (size_t a = 0; a < amos.size(); ++a) {
+        for (const auto& l : amos[a]) amoOcc[litIndex(l)].push_back(a);
+    }
+    for (const auto& c : clauses) {
+        if (c.size() == 1 && !enqueue(c.at(0))) { res.unsat = true; return res; }
+    }
+
+    // --- Propagation ---
+    for (size_t qi = 0; qi < queue.size(); ++qi) {
+        const Literal p = queue[qi];
+        for (size_t i : occ[litIndex(p)]) satisfied[i] = true;
+
+        // AMO: alle übrigen Literale falsch
+        for (size_t a : amoOcc[litIndex(p)]) {
+            for (const auto& o : amos[a]) {
+                if (o == p) continue;
+                if (!enqueue(Literal(o.getVar(), !o.isNegated()))) { res.unsat = true; return res; }
+            }
+        }
+
+        for (size_t i : occ[litIndex(p) ^ 1U]) {
+            if (satisfied[i]) continue;
+            if (--open[i] > 1) continue;
+            // Unit (oder Konflikt): verbleibendes Literal suchen
+            bool found = false;
+            for (const auto& l : clauses[i].getClause()) {
+                const int v = litValue(l);
+                if (v == 1) { satisfied[i] = true; found = true; break; }
+                if (v == -1) {
+                    if (!enqueue(l)) { res.unsat = true; return res; }
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) { res.unsat = true; return res; }
+        }
+    }
+
+    // --- Union-Find über die verbleibenden Klauseln/AMOs ---
+    std::vector<int> parent(numVars + 1);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto unite = [&](int a, int b) {
+        a = findRoot(parent, a);
+        b = findRoot(parent, b);
+        if (a != b) parent[a] = b;
+    };
+    auto openLits = [&](const std::vector<Literal>& lits) {
+        std::vector<Literal> out;
+        for (const auto& l : lits) {
+            if (litValue(l) == -1 && std::ranges::find(out, l) == out.end()) out.push_back(l);
+        }
+        return out;
+    };
+
+    std::vector<std::vector<Literal>> restClauses, restAmos;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        if (satisfied[i]) continue;
+        auto lits = openLits(clauses[i].getClause());
+        bool sat = false;
+        for (const auto& l : clauses[i].getClause()) if (litValue(l) == 1) { sat = true; break; }
+        if (sat) continue;
+        for (size_t k = 1; k < lits.size(); ++k) unite(lits[0].getVar(), lits[k].getVar());
+        restClauses.push_back(std::move(lits));
+    }
+    for (const auto& amo : amos) {
+        auto lits = openLits(amo);
+        if (lits.size() < 2) continue;
+        for (size_t k = 1; k < lits.size(); ++k) unite(lits[0].getVar(), lits[k].getVar());
+        restAmos.push_back(std::move(lits));
+    }
+
+    // --- Komponenten bilden (lokale Variablen-IDs in aufsteigender globaler Reihenfolge) ---
+    std::vector<int> compOf(numVars + 1, -1), localId(numVars + 1, 0);
+    std::vector<bool> used(numVars + 1, false);
+    for (const auto& c : restClauses) for (const auto& l : c) used[l.getVar()] = true;
+    for (const auto& a : restAmos)    for (const auto& l : a) used[l.getVar()] = true;
+
+    for (int v = 1; v <= numVars; ++v) {
+        if (!used[v]) continue;
+        const int r = findRoot(parent, v);
+        if (compOf[r] == -1) {
+            compOf[r] = static_cast<int>(res.components.size());
+            res.components.emplace_back();
+        }
+        auto& comp = res.components[compOf[r]];
+        comp.vars.push_back(v);
+        localId[v] = static_cast<int>(comp.vars.size());
+    }
+
+    auto toLocal = [&](const std::vector<Literal>& lits) {
+        std::vector<Literal> out;
+        out.reserve(lits.size());
+        for (const auto& l : lits) out.emplace_back(localId[l.getVar()], l.isNegated());
+        return out;
+    };
+    for (const auto& c : restClauses) {
+        auto& comp = res.components[compOf[findRoot(parent, c[0].getVar())]];
+        Clause cl(toLocal(c));
+        cl.initWatchesDefault();
+        comp.clauses.push_back(std::move(cl));
+    }
+    for (const auto& a : restAmos) {
+        res.components[compOf[findRoot(parent, a[0].getVar())]].amos.push_back(toLocal(a));
+    }
+
+    // Große Komponenten zuerst (bessere Auslastung der Worker)
+    std::stable_sort(res.components.begin(), res.components.end(), [](const Component& a, const Component& b) {
+        return a.clauses.size() > b.clauses.size();
+    });
+    return res;
+}
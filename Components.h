@@ -0,0 +1,31 @@
+
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Zerlegung der Formel in variablendisjunkte Komponenten.
+// Vorher werden Units auf Level 0 propagiert (inkl. AMO-Constraints); erfüllte
+// Klauseln und falsche Literale entfallen. Jede Komponente erhält eigene, dichte
+// Variablen-IDs, damit sie von einem eigenen Solver gelöst werden kann.
+class ComponentSplitter {
+public:
+    struct Component {
+        std::vector<int>                  vars;    // lokale Variable i (ab 1) → globale Variable vars[i-1]
+        std::vector<Clause>               clauses; // Klauseln über lokalen Variablen
+        std::vector<std::vector<Literal>> amos;    // AMO-Constraints über lokalen Variablen
+    };
+
+    struct Result {
+        bool                   unsat = false; // Widerspruch schon auf Level 0
+        std::vector<int>       fixed;         // Root-Belegung (global): -1 unbelegt, 0 false, 1 true
+        std::vector<Component> components;    // absteigend nach Anzahl Klauseln
+    };
+
+    Result split(const std::vector<Clause>& clauses, const std::vector<std::vector<Literal>>& amos,
+                 int numVars) const;
+};
+
+#endif // COMPONENTS_H
@@ -0,0 +1,151 @@
+// CubeAndConquer.cpp
+// ------------------
+// Scheduler: Deques mit je einem Mutex (kurze kritische Abschnitte, nur beim Nehmen/Ablegen
+// eines Cubes). 'pending' zählt offene Cubes (in Deques oder in Arbeit); erreicht er 0, sind
+// alle Cubes widerlegt und die Formel ist UNSAT.
+
+#include "CubeAndConquer.h"
+#include "Cuber.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace {
+
+struct Task {
+    std::vector<Literal> cube;
+    uint64_t             budget;
+};
+
+struct WorkQueue {
+    std::mutex       mtx;
+    std::deque<Task> tasks;
+
+    void push(Task t) {
+        std::lock_guard<std::mutex> lock(mtx);
+        tasks.push_back(std::move(t));
+    }
+    std::optional<Task> popBack() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (tasks.empty()) return std::nullopt;
+        Task t = std::move(tasks.back());
+        tasks.pop_back();
+        return t;
+    }
+    std::optional<Task> stealFront() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (tasks.empty()) return std::nullopt;
+        Task t = std::move(tasks.front());
+        tasks.pop_front();
+        return t;
+    }
+};
+
+} // namespace
+
+CubeAndConquer::CubeAndConquer(int numVars, const std::vector<Clause>& clauses,
+                               const std::vector<std::vector<Literal>>& amos, Options opts)
+    : numVars{numVars}, clauses{clauses}, amos{amos}, opts{opts} {}
+
+CubeAndConquer::Result CubeAndConquer::run(const std::vector<std::vector<Literal>>& cubes,
+                                           std::vector<std::unique_ptr<Solver>>& solvers) {
+    Result result;
+    const size_t n = solvers.size();
+    if (cubes.empty() || n == 0) return result; // Lookahead hat alles widerlegt
+
+    std::vector<WorkQueue> queues(n);
+    for (size_t i = 0; i < cubes.size(); ++i) {
+        queues[i % n].push({cubes[i], opts.conflictBudget});
+    }
+
+    std::atomic<bool>     stop{false};
+    std::atomic<int>      winner{-1};
+    std::atomic<int64_t>  pending{static_cast<int64_t>(cubes.size())};
+    std::atomic<uint64_t> solved{0}, splits{0}, steals{0};
+    bool                  sat = false;
+
+    auto work = [&](size_t k) {
+        Solver& solver = *solvers[k];
+        std::unique_ptr<Cuber> cuber; // erst beim ersten Teilen bauen
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            std::optional<Task> task = queues[k].popBack();
+            for (size_t d = 1; !task && d < n; ++d) {
+                task = queues[(k + d) % n].stealFront();
+                if (task) steals++;
+            }
+            if (!task) {
+                if (pending.load() == 0) break;
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                continue;
+            }
+
+            solver.setConflictLimit(task->budget);
+            const bool res = solver.solve(task->cube);
+
+            if (solver.isInterrupted()) {
+                if (stop.load()) break;
+                // Budget erschöpft: Cube am besten Lookahead-Literal teilen
+                if (task->cube.size() >= opts.maxCubeLength) {
+                    task->budget *= 2;
+                    queues[k].push(std::move(*task));
+                    continue;
+                }
+                if (!cuber) cuber = std::make_unique<Cuber>(numVars, clauses, amos);
+                bool refuted = false;
+                const int v = cuber->splitVariable(task->cube, refuted);
+                if (refuted) {
+                    pending--;
+                } else if (v == 0) {
+                    task->budget *= 2;
+                    queues[k].push(std::move(*task));
+                } else {
+                    Task neg{task->cube, task->budget};
+                    neg.cube.emplace_back(v, true);
+                    task->cube.emplace_back(v, false);
+                    pending++;
+                    splits++;
+                    queues[k].push(std::move(neg));
+                    queues[k].push(std::move(*task));
+                }
+                continue;
+            }
+
+            if (res || solver.isRootUnsat()) {
+                // Modell gefunden bzw. Formel ohne Annahmen widerlegt: alle anhalten
+                int none = -1;
+                if (winner.compare_exchange_strong(none, static_cast<int>(k))) {
+                    sat = res;
+                    if (res) result.model = solver.getModel();
+                    stop = true;
+                }
+                break;
+            }
+            solved++;
+            pending--;
+        }
+    };
+
+    for (auto& s : solvers) {
+        s->setStopFlag(&stop);
+    }
+    std::vector<std::thread> pool;
+    for (size_t k = 1; k < n; ++k) {
+        pool.emplace_back(work, k);
+    }
+    work(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+
+    result.sat         = sat;
+    result.winner      = winner.load();
+    result.solvedCubes = solved.load();
+    result.splits      = splits.load();
+    result.steals      = steals.load();
+    return result;
+}
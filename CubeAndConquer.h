@@ -0,0 +1,46 @@
+
+#ifndef CUBEANDCONQUER_H
+#define CUBEANDCONQUER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+#include "Solver.h"
+
+// Cube-and-Conquer: die Cubes des Lookahead-Cubers werden als Annahmen auf einem Pool von
+// Solvern gelöst (ein Solver je Worker, gelernte Klauseln bleiben zwischen den Cubes erhalten).
+// Jeder Worker hat eine eigene Deque: er nimmt hinten, Diebe stehlen vorne. Ein Cube, der sein
+// Konfliktbudget aufbraucht, wird per Lookahead in zwei Teil-Cubes zerlegt, die wieder in die
+// Deque des Workers wandern – schwere Cubes werden so weiter geteilt, leichte laufen durch.
+class CubeAndConquer {
+public:
+    struct Options {
+        uint64_t conflictBudget = 10000; // Konflikte je Cube, bevor er geteilt wird
+        size_t   maxCubeLength  = 64;    // längere Cubes werden nicht mehr geteilt (Budget verdoppelt)
+    };
+
+    struct Result {
+        bool             sat    = false;
+        int              winner = -1;      // Worker mit dem Modell (bzw. der Widerlegung der Formel)
+        std::vector<int> model;            // Belegung inkl. Rekonstruktion (nur SAT)
+        uint64_t solvedCubes = 0;          // #durch einen Solver widerlegter Cubes
+        uint64_t splits      = 0;          // #geteilter Cubes
+        uint64_t steals      = 0;          // #gestohlener Cubes
+    };
+
+    CubeAndConquer(int numVars, const std::vector<Clause>& clauses,
+                   const std::vector<std::vector<Literal>>& amos, Options opts);
+
+    // Cubes verteilen und lösen; solvers[k] ist der Solver von Worker k
+    Result run(const std::vector<std::vector<Literal>>& cubes, std::vector<std::unique_ptr<Solver>>& solvers);
+
+private:
+    int numVars;
+    const std::vector<Clause>&               clauses; // für die Cuber der Worker (erst bei Bedarf gebaut)
+    const std::vector<std::vector<Literal>>& amos;
+    Options opts;
+};
+
+#endif // CUBEANDCONQUER_H
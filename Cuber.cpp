@@ -0,0 +1,257 @@
+// Cuber.cpp
+// ---------
+// Lookahead auf einer eigenen Kopie der Formel. Kandidaten sind die am häufigsten
+// vorkommenden freien Variablen (höchstens maxCandidates je Knoten), damit ein
+// Lookahead-Schritt auch auf großen Formeln billig bleibt.
+
+#include "Cuber.h"
+
+#include <algorithm>
+#include <fstream>
+
+Cuber::Cuber(int numVars, const std::vector<Clause>& clauses, const std::vector<std::vector<Literal>>& amos)
+    : numVars{numVars},
+      watches(2 * static_cast<size_t>(numVars + 1)),
+      amoOcc(2 * static_cast<size_t>(numVars + 1)),
+      value(numVars + 1, -1) {
+    std::vector<uint32_t> occurrences(numVars + 1, 0);
+    std::vector<uint32_t> units;
+    std::vector<uint32_t> buf;
+
+    for (const auto& c : clauses) {
+        buf.clear();
+        bool tautology = false;
+        for (const auto& l : c.getClause()) {
+            const uint32_t x = code(l);
+            if (std::ranges::find(buf, x ^ 1u) != buf.end()) { tautology = true; break; }
+            if (std::ranges::find(buf, x) == buf.end()) buf.push_back(x);
+        }
+        if (tautology) continue;
+        if (buf.empty()) { rootConflict = true; continue; }
+        if (buf.size() == 1) { units.push_back(buf[0]); continue; }
+
+        const auto idx = static_cast<uint32_t>(start.size() - 1);
+        for (uint32_t x : buf) {
+            lits.push_back(x);
+            ++occurrences[x >> 1];
+        }
+        start.push_back(static_cast<uint32_t>(lits.size()));
+        watches[buf[0]].push_back(idx);
+        watches[buf[1]].push_back(idx);
+    }
+
+    for (const auto& amo : amos) {
+        const auto idx = static_cast<uint32_t>(amoStart.size() - 1);
+        for (const auto& l : amo) {
+            amoLits.push_back(code(l));
+            amoOcc[code(l)].push_back(idx);
+            ++occurrences[l.getVar()];
+        }
+        amoStart.push_back(static_cast<uint32_t>(amoLits.size()));
+    }
+
+    for (int v = 1; v <= numVars; ++v) {
+        if (occurrences[v] > 0) candidates.push_back(v);
+    }
+    std::ranges::stable_sort(candidates, [&](int a, int b) { return occurrences[a] > occurrences[b]; });
+
+    // Units auf Level 0
+    for (uint32_t u : units) {
+        if (rootConflict) break;
+        if (!assume(u)) rootConflict = true;
+    }
+    rootSize = trail.size();
+}
+
+bool Cuber::assume(uint32_t x) {
+    if (isTrue(x)) return true;
+    if (isFalse(x)) return false;
+    value[x >> 1] = static_cast<int8_t>(!(x & 1));
+    trail.push_back(x);
+    return propagate();
+}
+
+bool Cuber::propagate() {
+    auto set = [&](uint32_t x) {
+        value[x >> 1] = static_cast<int8_t>(!(x & 1));
+        trail.push_back(x);
+    };
+
+    while (qhead < trail.size()) {
+        const uint32_t p = trail[qhead++];
+
+        // AMO: alle anderen Literale eines Constraints mit p werden falsch
+        for (uint32_t a : amoOcc[p]) {
+            for (uint32_t k = amoStart[a]; k < amoStart[a + 1]; ++k) {
+                const uint32_t q = amoLits[k];
+                if (q == p) continue;
+                if (isTrue(q)) return false;
+                if (!isFalse(q)) set(q ^ 1u);
+            }
+        }
+
+        // Klauseln, die ¬p beobachten
+        const uint32_t falseLit = p ^ 1u;
+        auto& ws = watches[falseLit];
+        size_t j = 0;
+        for (size_t i = 0; i < ws.size(); ++i) {
+            const uint32_t c = ws[i];
+            uint32_t* cl = lits.data() + start[c];
+            const uint32_t size = start[c + 1] - start[c];
+            if (cl[0] == falseLit) std::swap(cl[0], cl[1]);
+
+            if (isTrue(cl[0])) { ws[j++] = c; continue; }
+
+            bool moved = false;
+            for (uint32_t k = 2; k < size; ++k) {
+                if (!isFalse(cl[k])) {
+                    std::swap(cl[1], cl[k]);
+                    watches[cl[1]].push_back(c);
+                    moved = true;
+                    break;
+                }
+            }
+            if (moved) continue;
+
+            ws[j++] = c;
+            if (isFalse(cl[0])) {
+                for (++i; i < ws.size(); ++i) ws[j++] = ws[i];
+                ws.resize(j);
+                return false;
+            }
+            set(cl[0]);
+        }
+        ws.resize(j);
+    }
+    return true;
+}
+
+void Cuber::backtrack(size_t size) {
+    while (trail.size() > size) {
+        value[trail.back() >> 1] = -1;
+        trail.pop_back();
+    }
+    qhead = size;
+}
+
+int Cuber::select(bool& refuted) {
+    refuted = false;
+    while (true) {
+        int      best      = 0;
+        uint64_t bestScore = 0;
+        size_t   tried     = 0;
+
+        for (int v : candidates) {
+            if (tried >= maxCandidates) break;
+            if (value[v] != -1) continue;
+            ++tried;
+            ++numLookaheads;
+
+            const size_t mark = trail.size();
+            const uint32_t pos = 2u * static_cast<uint32_t>(v);
+            const bool okPos = assume(pos);
+            const uint64_t rPos = trail.size() - mark;
+            backtrack(mark);
+            const bool okNeg = assume(pos | 1u);
+            const uint64_t rNeg = trail.size() - mark;
+            backtrack(mark);
+
+            if (!okPos && !okNeg) {
+                refuted = true;
+                return 0;
+            }
+            if (!okPos || !okNeg) {
+                // Failed Literal: die andere Seite gilt in diesem Knoten
+                if (!assume(okPos ? pos : (pos | 1u))) {
+                    refuted = true;
+                    return 0;
+                }
+                continue;
+            }
+
+            const uint64_t score = (1 + rPos) * (1 + rNeg);
+            if (score > bestScore) {
+                bestScore = score;
+                best = v;
+            }
+        }
+
+        // Die beste Variable kann durch ein später gefundenes Failed Literal belegt sein
+        if (best == 0 || value[best] == -1) return best;
+    }
+}
+
+void Cuber::descend(std::vector<Literal>& path, int depth, Result& out) {
+    const size_t mark = trail.size();
+    bool refuted = false;
+    const int v = depth > 0 ? select(refuted) : 0;
+
+    if (!refuted) {
+        if (v == 0) {
+            out.cubes.push_back(path);
+        } else {
+            for (const uint32_t x : {2u * static_cast<uint32_t>(v), 2u * static_cast<uint32_t>(v) + 1u}) {
+                const size_t branch = trail.size();
+                if (assume(x)) {
+                    path.emplace_back(static_cast<int>(x >> 1), (x & 1u) != 0);
+                    descend(path, depth - 1, out);
+                    path.pop_back();
+                }
+                backtrack(branch);
+            }
+        }
+    }
+    backtrack(mark);
+}
+
+Cuber::Result Cuber::cube(int maxDepth) {
+    Result r;
+    if (!rootConflict) {
+        backtrack(rootSize);
+        std::vector<Literal> path;
+        descend(path, maxDepth, r);
+    }
+    r.unsat = r.cubes.empty();
+    return r;
+}
+
+int Cuber::splitVariable(const std::vector<Literal>& prefix, bool& refuted) {
+    refuted = rootConflict;
+    if (refuted) return 0;
+    backtrack(rootSize);
+
+    int v = 0;
+    if (std::ranges::all_of(prefix, [&](const Literal& l) { return assume(code(l)); })) {
+        v = select(refuted);
+    } else {
+        refuted = true;
+    }
+    backtrack(rootSize);
+    return v;
+}
+
+bool Cuber::writeICNF(const std::filesystem::path& path, const std::vector<Clause>& clauses,
+                      const std::vector<std::vector<Literal>>& amos,
+                      const std::vector<std::vector<Literal>>& cubes) {
+    std::ofstream out{path, std::ios::out | std::ios::trunc};
+    if (!out.is_open()) return false;
+
+    out << "p inccnf\n";
+    for (const auto& c : clauses) {
+        for (const auto& l : c.getClause()) out << l.toInt() << ' ';
+        out << "0\n";
+    }
+    for (const auto& amo : amos) {
+        for (size_t i = 0; i < amo.size(); ++i) {
+            for (size_t j = i + 1; j < amo.size(); ++j) {
+                out << -amo[i].toInt() << ' ' << -amo[j].toInt() << " 0\n";
+            }
+        }
+    }
+    for (const auto& cube : cubes) {
+        out << 'a';
+        for (const auto& l : cube) out << ' ' << l.toInt();
+        out << " 0\n";
+    }
+    return out.good();
+}
@@ -0,0 +1,83 @@
+
+#ifndef CUBER_H
+#define CUBER_H
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Lookahead-Cuber für Cube-and-Conquer.
+// Für jede Kandidatenvariable x werden x und ¬x probeweise propagiert; bewertet wird die
+// Reduktion (#neu belegter Variablen) beider Seiten als Produkt (1 + r(x)) * (1 + r(¬x)).
+// Die beste Variable teilt den Suchraum; Zweige, deren Propagation einen Konflikt liefert,
+// fallen weg. Fehlgeschlagene Literale (nur eine Seite konfliktfrei) werden dabei gleich gesetzt.
+// Eigene, kleine Propagation (Two-Watched-Literals + AMO nativ), unabhängig vom Solver;
+// eine Instanz ist nicht thread-sicher, pro Thread also eine eigene verwenden.
+class Cuber {
+public:
+    struct Result {
+        bool unsat = false;                       // alle Zweige widerlegt
+        std::vector<std::vector<Literal>> cubes;  // Blätter des Lookahead-Baums
+    };
+
+    Cuber(int numVars, const std::vector<Clause>& clauses, const std::vector<std::vector<Literal>>& amos);
+
+    // Suchraum bis zur Tiefe maxDepth aufteilen (Blätter = Cubes)
+    Result cube(int maxDepth);
+
+    // Beste Verzweigungsvariable unter den Annahmen 'prefix'.
+    // 0 = keine (prefix widerlegt → refuted = true, sonst alles belegt)
+    int splitVariable(const std::vector<Literal>& prefix, bool& refuted);
+
+    // Formel + Cubes im iCNF-Format schreiben ("p inccnf", Klauseln, je Cube "a ... 0").
+    // AMO-Constraints werden als paarweise Binärklauseln ausgegeben. false = Schreibfehler
+    static bool writeICNF(const std::filesystem::path& path, const std::vector<Clause>& clauses,
+                          const std::vector<std::vector<Literal>>& amos,
+                          const std::vector<std::vector<Literal>>& cubes);
+
+    uint64_t lookaheads() const { return numLookaheads; }
+
+private:
+    int numVars;
+
+    // Klauseln flach: Literal-Codes 2*var + neg; Klausel i = lits[start[i] .. start[i+1]),
+    // die beiden ersten Literale einer Klausel sind beobachtet
+    std::vector<uint32_t> lits;
+    std::vector<uint32_t> start{0};
+    std::vector<std::vector<uint32_t>> watches; // je Literal-Code: Klauseln, die ihn beobachten
+
+    // AMO-Constraints (CSR) und Vorkommen je Literal-Code
+    std::vector<uint32_t> amoLits;
+    std::vector<uint32_t> amoStart{0};
+    std::vector<std::vector<uint32_t>> amoOcc;
+
+    std::vector<int8_t>   value;     // je Variable: -1 unbelegt, 0/1
+    std::vector<uint32_t> trail;     // gesetzte Literal-Codes
+    size_t                qhead = 0;
+    size_t                rootSize = 0;   // Trail-Länge nach Propagation der Units
+    bool                  rootConflict = false;
+
+    std::vector<int>      candidates; // Variablen nach Vorkommen absteigend
+    size_t                maxCandidates = 64;
+    uint64_t              numLookaheads = 0;
+
+    bool isTrue(uint32_t code) const  { return value[code >> 1] == static_cast<int8_t>(!(code & 1)); }
+    bool isFalse(uint32_t code) const { return value[code >> 1] == static_cast<int8_t>(code & 1); }
+
+    // Literal setzen und propagieren; false = Konflikt (Trail bleibt, backtrack() räumt auf)
+    bool assume(uint32_t code);
+    bool propagate();
+    void backtrack(size_t size);
+
+    // Beste Variable im aktuellen Zustand; setzt gefundene Failed Literals.
+    // 0 = keine Variable mehr frei; refuted = Zustand widersprüchlich
+    int  select(bool& refuted);
+
+    void descend(std::vector<Literal>& path, int depth, Result& out);
+
+    static uint32_t code(const Literal& l) { return 2u * static_cast<uint32_t>(l.getVar()) + (l.isNegated() ? 1u : 0u); }
+};
+
+#endif // CUBER_H
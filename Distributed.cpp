@@ -0,0 +1,419 @@
+// Distributed.cpp
+// ---------------
+// Koordinator: ein poll()-Loop über alle Worker-Sockets. Worker: der Hauptthread löst, ein
+// Lese-Thread nimmt Aufträge/Klauseln/Abbruch entgegen, ein Sende-Thread gibt die exportierten
+// Klauseln weiter. Die Klauseln laufen im Worker über eine ClauseExchange mit zwei Seiten
+// (0 = Solver, 1 = Netz), sodass der Solver dieselben Import/Export-Pfade wie im Thread-Portfolio
+// nutzt. Da jeder Worker ständig liest, kann ein blockierendes Senden des Koordinators nicht
+// dauerhaft hängen.
+
+#include "Distributed.h"
+#include "BinaryFormula.h"
+#include "ClauseExchange.h"
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define GUMS_HAVE_PROCESSES 1
+#endif
+
+#ifdef GUMS_HAVE_PROCESSES
+
+Channel::~Channel() {
+    close();
+}
+
+void Channel::close() {
+    if (sock >= 0) ::close(sock);
+    sock = -1;
+}
+
+bool Channel::send(Type type, const std::vector<int32_t>& data) {
+    std::vector<int32_t> frame;
+    frame.reserve(data.size() + 2);
+    frame.push_back(static_cast<int32_t>(type));
+    frame.push_back(static_cast<int32_t>(data.size()));
+    frame.insert(frame.end(), data.begin(), data.end());
+
+    std::lock_guard<std::mutex> lock(sendMtx);
+    const char* p = reinterpret_cast<const char*>(frame.data());
+    size_t left = frame.size() * sizeof(int32_t);
+    while (left > 0) {
+        const ssize_t n = ::send(sock, p, left, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+namespace {
+
+bool readFull(int fd, void* dst, size_t size) {
+    char* p = static_cast<char*>(dst);
+    while (size > 0) {
+        const ssize_t n = ::read(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+bool Channel::receive(Message& msg) {
+    int32_t head[2];
+    if (!readFull(sock, head, sizeof(head)) || head[1] < 0) return false;
+    msg.type = static_cast<Type>(head[0]);
+    msg.data.resize(static_cast<size_t>(head[1]));
+    return readFull(sock, msg.data.data(), msg.data.size() * sizeof(int32_t));
+}
+
+namespace {
+
+// ------------------------------------------------------------
+// Worker-Prozess
+// ------------------------------------------------------------
+
+[[noreturn]] void workerProcess(const std::string& shmName, size_t shmSize, int sock, bool share) {
+    // Formel aus dem Shared Memory (read-only)
+    const int shm = shm_open(shmName.c_str(), O_RDONLY, 0);
+    if (shm < 0) _exit(2);
+    void* mem = mmap(nullptr, shmSize, PROT_READ, MAP_SHARED, shm, 0);
+    ::close(shm);
+    if (mem == MAP_FAILED) _exit(2);
+
+    BinaryFormula formula;
+    std::vector<Clause> clauses;
+    if (!formula.attach(static_cast<const char*>(mem), shmSize) || !formula.decode(clauses)) _exit(2);
+    const int numVars = formula.numVariables();
+
+    Channel channel{sock};
+    ClauseExchange exchange{2};
+    std::atomic<bool> stop{false};
+
+    // Aufträge vom Lese-Thread an den Hauptthread
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::vector<int32_t>> jobs;
+    std::vector<std::vector<Literal>> amos;
+    bool amosReceived = false;
+    bool closed = false;
+
+    std::thread reader([&] {
+        Channel::Message msg;
+        while (channel.receive(msg)) {
+            if (msg.type == Channel::Type::CLAUSE && msg.data.size() >= 2) {
+                exchange.publish(1, msg.data.data() + 1, msg.data.size() - 1, msg.data[0]);
+            } else if (msg.type == Channel::Type::AMO) {
+                std::lock_guard<std::mutex> lock(mtx);
+                for (size_t i = 0; i < msg.data.size(); i += static_cast<size_t>(msg.data[i]) + 1) {
+                    std::vector<Literal> amo;
+                    for (int32_t k = 1; k <= msg.data[i] && i + k < msg.data.size(); ++k) {
+                        const int32_t x = msg.data[i + k];
+                        amo.emplace_back(x < 0 ? -x : x, x < 0);
+                    }
+                    amos.push_back(std::move(amo));
+                }
+                amosReceived = true;
+                cv.notify_all();
+            } else if (msg.type == Channel::Type::JOB) {
+                std::lock_guard<std::mutex> lock(mtx);
+                jobs.push_back(std::move(msg.data));
+                cv.notify_all();
+            }
+        }
+        // Verbindung beendet: laufende Suche abbrechen
+        stop = true;
+        std::lock_guard<std::mutex> lock(mtx);
+        closed = true;
+        cv.notify_all();
+    });
+    reader.detach();
+
+    if (share) {
+        std::thread sender([&] {
+            std::vector<ClauseExchange::SharedClause> buf;
+            std::vector<int32_t> data;
+            while (!stop.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                buf.clear();
+                exchange.collect(1, buf);
+                for (const auto& sc : buf) {
+                    data.assign(1, sc.lbd);
+                    data.insert(data.end(), sc.lits.begin(), sc.lits.begin() + sc.size);
+                    if (!channel.send(Channel::Type::CLAUSE, data)) return;
+                }
+            }
+        });
+        sender.detach();
+    }
+
+    std::unique_ptr<Solver> solver;
+    while (true) {
+        std::vector<int32_t> job;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&] { return closed || (amosReceived && !jobs.empty()); });
+            if (closed) break;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        if (job.size() < 4) break;
+
+        // Der erste Auftrag legt die Konfiguration fest; danach bleibt der Solver bestehen
+        if (!solver) {
+            solver = std::make_unique<Solver>(numVars);
+            solver->setHeuristic(static_cast<HeuristicType>(job[0]));
+            solver->setRestartPolicy(static_cast<RestartPolicy>(job[1]));
+            solver->setHeuristicSeed(static_cast<uint32_t>(job[2]) | (static_cast<uint64_t>(static_cast<uint32_t>(job[3])) << 32));
+            solver->setVerbose(false);
+            solver->setStopFlag(&stop);
+            if (share) solver->setClauseExchange(&exchange, 0);
+            for (const auto& lits : amos) {
+                solver->addAtMostOne(lits);
+            }
+            solver->loadClauses(std::move(clauses));
+        }
+
+        std::vector<Literal> cube;
+        for (size_t i = 4; i < job.size(); ++i) cube.emplace_back(job[i] < 0 ? -job[i] : job[i], job[i] < 0);
+
+        const bool res = solver->solve(cube);
+        if (solver->isInterrupted()) break;
+        if (res) {
+            const std::vector<int> model = solver->getModel();
+            channel.send(Channel::Type::SAT, std::vector<int32_t>(model.begin() + 1, model.end()));
+        } else if (cube.empty() || solver->isRootUnsat()) {
+            channel.send(Channel::Type::UNSAT, {});
+        } else {
+            channel.send(Channel::Type::CUBE_UNSAT, {});
+        }
+    }
+    std::cout.flush();
+    _exit(0);
+}
+
+std::vector<int32_t> encodeJob(const DistributedSolver::Job& job, const std::vector<Literal>& cube) {
+    std::vector<int32_t> data = {static_cast<int32_t>(job.heuristic), static_cast<int32_t>(job.restart),
+                                 static_cast<int32_t>(static_cast<uint32_t>(job.seed)),
+                                 static_cast<int32_t>(static_cast<uint32_t>(job.seed >> 32))};
+    for (const auto& l : cube) data.push_back(l.toInt());
+    return data;
+}
+
+} // namespace
+
+// ------------------------------------------------------------
+// Koordinator
+// ------------------------------------------------------------
+
+DistributedSolver::DistributedSolver(int numVars, const std::vector<Clause>& clauses,
+                                     const std::vector<std::vector<Literal>>& amos)
+    : numVars{numVars}, clauses{clauses}, amos{amos} {}
+
+DistributedSolver::Result DistributedSolver::run(const std::vector<Job>& jobs,
+                                                 const std::vector<std::vector<Literal>>& cubes, bool share) {
+    Result result;
+    const size_t n = jobs.size();
+    if (n == 0) {
+        result.error = "keine Worker";
+        return result;
+    }
+
+    // --- Formel ins Shared Memory ---
+    static std::atomic<int> instance{0};
+    const std::string shmName = "/gums-" + std::to_string(getpid()) + "-" + std::to_string(instance++);
+    const size_t shmSize = BinaryFormula::encodedSize(clauses);
+    const int shm = shm_open(shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (shm < 0) {
+        result.error = "shm_open fehlgeschlagen";
+        return result;
+    }
+    void* mem = MAP_FAILED;
+    if (ftruncate(shm, static_cast<off_t>(shmSize)) == 0) {
+        mem = mmap(nullptr, shmSize, PROT_READ | PROT_WRITE, MAP_SHARED, shm, 0);
+    }
+    ::close(shm);
+    if (mem == MAP_FAILED) {
+        shm_unlink(shmName.c_str());
+        result.error = "Shared Memory konnte nicht angelegt werden";
+        return result;
+    }
+    BinaryFormula::encode(static_cast<char*>(mem), numVars, clauses, 0, 0);
+    munmap(mem, shmSize);
+
+    // --- Worker starten ---
+    std::signal(SIGPIPE, SIG_IGN);
+    std::cout.flush();
+    std::cerr.flush();
+    std::vector<std::unique_ptr<Channel>> channels;
+    std::vector<pid_t> pids;
+    for (size_t k = 0; k < n; ++k) {
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) break;
+        const pid_t pid = fork();
+        if (pid == 0) {
+            ::close(sv[0]);
+            for (auto& ch : channels) ch->close();
+            workerProcess(shmName, shmSize, sv[1], share);
+        }
+        ::close(sv[1]);
+        if (pid < 0) {
+            ::close(sv[0]);
+            break;
+        }
+        channels.push_back(std::make_unique<Channel>(sv[0]));
+        pids.push_back(pid);
+    }
+
+    auto shutdown = [&] {
+        for (pid_t pid : pids) kill(pid, SIGKILL);
+        for (pid_t pid : pids) waitpid(pid, nullptr, 0);
+        shm_unlink(shmName.c_str());
+    };
+    if (channels.size() != n) {
+        shutdown();
+        result.error = "Worker-Prozesse konnten nicht gestartet werden";
+        return result;
+    }
+
+    // --- AMO-Constraints und erste Aufträge verteilen ---
+    std::vector<int32_t> amoData;
+    for (const auto& amo : amos) {
+        amoData.push_back(static_cast<int32_t>(amo.size()));
+        for (const auto& l : amo) amoData.push_back(l.toInt());
+    }
+    std::vector<bool> alive(n, true);
+    std::vector<int>  current(n, -1);   // Cube in Arbeit (Index in cubes), -1 = keiner
+    std::deque<int>   open;             // noch nicht vergebene Cubes
+    for (size_t i = 0; i < cubes.size(); ++i) open.push_back(static_cast<int>(i));
+
+    auto assignNext = [&](size_t k) {
+        if (cubes.empty()) return channels[k]->send(Channel::Type::JOB, encodeJob(jobs[k], {}));
+        current[k] = -1;
+        if (open.empty()) return true;
+        current[k] = open.front();
+        open.pop_front();
+        return channels[k]->send(Channel::Type::JOB, encodeJob(jobs[k], cubes[current[k]]));
+    };
+    for (size_t k = 0; k < n; ++k) {
+        if (!channels[k]->send(Channel::Type::AMO, amoData) || !assignNext(k)) alive[k] = false;
+    }
+
+    // --- Nachrichten verarbeiten, bis ein Ergebnis feststeht ---
+    bool done = false;
+    std::vector<pollfd> fds;
+    Channel::Message msg;
+    while (!done) {
+        fds.clear();
+        std::vector<size_t> owner;
+        for (size_t k = 0; k < n; ++k) {
+            if (!alive[k]) continue;
+            fds.push_back({channels[k]->fd(), POLLIN, 0});
+            owner.push_back(k);
+        }
+        if (fds.empty()) {
+            result.error = "alle Worker-Prozesse beendet";
+            break;
+        }
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            result.error = "poll fehlgeschlagen";
+            break;
+        }
+
+        for (size_t i = 0; i < fds.size() && !done; ++i) {
+            if (fds[i].revents == 0) continue;
+            const size_t k = owner[i];
+            if (!channels[k]->receive(msg)) {
+                // Worker ausgefallen: seinen Cube erneut vergeben
+                alive[k] = false;
+                if (current[k] >= 0) open.push_front(current[k]);
+                current[k] = -1;
+                continue;
+            }
+
+            switch (msg.type) {
+                case Channel::Type::CLAUSE:
+                    for (size_t j = 0; j < n; ++j) {
+                        if (j == k || !alive[j]) continue;
+                        if (channels[j]->send(Channel::Type::CLAUSE, msg.data)) result.relayed++;
+                    }
+                    break;
+                case Channel::Type::SAT:
+                    result.sat = true;
+                    result.model.assign(1, -1);
+                    result.model.insert(result.model.end(), msg.data.begin(), msg.data.end());
+                    result.winner = static_cast<int>(k);
+                    done = true;
+                    break;
+                case Channel::Type::UNSAT:
+                    result.winner = static_cast<int>(k);
+                    done = true;
+                    break;
+                case Channel::Type::CUBE_UNSAT:
+                    result.cubesRefuted++;
+                    if (!assignNext(k)) alive[k] = false;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Cube-Modus: alle Cubes widerlegt → UNSAT
+        if (!done && !cubes.empty() && open.empty()) {
+            bool busy = false;
+            for (size_t k = 0; k < n; ++k) busy = busy || (alive[k] && current[k] >= 0);
+            if (!busy) {
+                done = true;
+                result.winner = 0;
+            }
+        }
+        // Freie Worker mit zurückgegebenen Cubes versorgen
+        for (size_t k = 0; k < n && !done && !open.empty(); ++k) {
+            if (alive[k] && current[k] < 0 && !cubes.empty() && !assignNext(k)) alive[k] = false;
+        }
+    }
+
+    result.ok = done;
+    shutdown();
+    return result;
+}
+
+#else
+
+Channel::~Channel() = default;
+void Channel::close() {}
+bool Channel::send(Type, const std::vector<int32_t>&) { return false; }
+bool Channel::receive(Message&) { return false; }
+
+DistributedSolver::DistributedSolver(int numVars, const std::vector<Clause>& clauses,
+                                     const std::vector<std::vector<Literal>>& amos)
+    : numVars{numVars}, clauses{clauses}, amos{amos} {}
+
+DistributedSolver::Result DistributedSolver::run(const std::vector<Job>&, const std::vector<std::vector<Literal>>&, bool) {
+    Result result;
+    result.error = "Mehrprozess-Modus auf dieser Plattform nicht unterstützt";
+    return result;
+}
+
+#endif
@@ -0,0 +1,87 @@
+
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+#include "Solver.h"
+
+// Nachrichtenkanal über einen Stream-Socket (hier Unix Domain Sockets; derselbe Rahmen
+// funktioniert unverändert über TCP). Rahmen: int32 Typ | int32 Länge | int32 Daten[Länge]
+class Channel {
+public:
+    enum class Type : int32_t {
+        AMO = 1,     // Koordinator → Worker: AMO-Constraints (je Länge, Literale ...)
+        JOB,         // Koordinator → Worker: Heuristik, Restart, Seed (2×32 Bit), Cube-Literale ...
+        CLAUSE,      // beide Richtungen: LBD, Literale ...
+        SAT,         // Worker → Koordinator: Belegung der Variablen 1..n (-1/0/1)
+        UNSAT,       // Worker → Koordinator: Formel (ohne Annahmen) widerlegt
+        CUBE_UNSAT,  // Worker → Koordinator: Cube widerlegt, bereit für den nächsten
+    };
+
+    struct Message {
+        Type                 type = Type::AMO;
+        std::vector<int32_t> data;
+    };
+
+    explicit Channel(int fd = -1) : sock{fd} {}
+    ~Channel();
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    // Nachricht vollständig senden (thread-sicher). false = Verbindung getrennt
+    bool send(Type type, const std::vector<int32_t>& data);
+    // Nächste Nachricht blockierend lesen. false = Verbindung getrennt
+    bool receive(Message& msg);
+
+    int  fd() const { return sock; }
+    void close();
+
+private:
+    int        sock;
+    std::mutex sendMtx;
+};
+
+// Verteiltes Lösen mit Worker-Prozessen (fork) auf einem Rechner.
+// Der Koordinator legt die Formel einmal im Binärformat (.gcnf-Layout) in ein Shared-Memory-
+// Segment; jeder Worker blendet es read-only ein und baut daraus seinen Solver. Über je einen
+// Unix-Domain-Socket verteilt der Koordinator Konfigurationen bzw. Cubes und leitet kurze
+// gelernte Klauseln an die übrigen Worker weiter. Sobald ein Ergebnis feststeht, werden alle
+// Worker beendet (SIGKILL).
+class DistributedSolver {
+public:
+    struct Job {
+        HeuristicType heuristic;
+        RestartPolicy restart;
+        uint64_t      seed;
+    };
+
+    struct Result {
+        bool             ok     = false;   // false = Fehler (siehe error), Ergebnis unbekannt
+        bool             sat    = false;
+        int              winner = -1;      // Worker, der das Ergebnis geliefert hat
+        std::vector<int> model;            // Belegung (Index = Variable, ohne externe Rekonstruktion)
+        uint64_t         relayed      = 0; // #weitergeleiteter Klauseln (pro Empfänger gezählt)
+        uint64_t         cubesRefuted = 0; // #widerlegter Cubes
+        std::string      error;
+    };
+
+    DistributedSolver(int numVars, const std::vector<Clause>& clauses, const std::vector<std::vector<Literal>>& amos);
+
+    // Ein Worker-Prozess je Eintrag in 'jobs'. Ohne Cubes löst jeder Worker die ganze Formel
+    // mit seiner Konfiguration (Portfolio); sonst erhalten freie Worker nacheinander die Cubes.
+    // share = gelernte Klauseln zwischen den Workern weiterleiten
+    Result run(const std::vector<Job>& jobs, const std::vector<std::vector<Literal>>& cubes, bool share);
+
+private:
+    int numVars;
+    const std::vector<Clause>&               clauses;
+    const std::vector<std::vector<Literal>>& amos;
+};
+
+#endif // DISTRIBUTED_H
@@ -37,8 +37,8 @@ std::pair<int, bool> Heuristic::pickJeroslowWangVar(const std::vector<int>& assi
 
     // Alle Variablen durchgehen
     for (int v = 1; v <= numVars; ++v) {
-        if (assignment[v] != -1) {
-            continue; // überspringen, wenn schon belegt
+        if (assignment[v] != -1 || isEliminated(v)) {
+            continue; // überspringen, wenn schon belegt oder eliminiert
         }
 
         // Scores der Variable
@@ -65,7 +65,7 @@ std::pair<int, bool> Heuristic::pickJeroslowWangVar(const std::vector<int>& assi
     if (bestVar == -1) {
         int v = -1;
         for (int i = 1; i <= numVars; ++i) {
-            if (assignment[i] == -1) { v = i; break; }
+            if (assignment[i] == -1 && !isEliminated(i)) { v = i; break; }
         }
         if (v == -1) return {-1, false}; // alles belegt
 
@@ -117,7 +117,7 @@ void Heuristic::updateJeroslowWang(const Clause& newClause) {
 void Heuristic::update(const Trail& trail, int numVars) {
     unassignedVars.clear();
     for (int var = 1; var <= numVars; ++var) {
-        if (!trail.isAssigned(var)) {
+        if (!isEliminated(var) && !trail.isAssigned(var)) {
             unassignedVars.insert(var);
         }
     }
@@ -145,9 +145,22 @@ void Heuristic::initializeVSIDS(int numVars, double decay) {
     vsidsVarDecay = decay;                  // Zerfallsrate
 }
 
+// Neue Variablen starten mit Aktivität 0 (kommen beim ersten Bump/Backtrack in den Heap)
+void Heuristic::growVars(int numVars) {
+    const int old = static_cast<int>(vsidsActivity.size()) - 1;
+    if (numVars <= old) return;
+    vsidsActivity.resize(numVars + 1, 0.0);
+    vsidsPos.resize(numVars + 1, -1);
+    if (!jwPosScores.empty()) {
+        jwPosScores.resize(numVars + 1, 0.0);
+        jwNegScores.resize(numVars + 1, 0.0);
+    }
+    for (int v = old + 1; v <= numVars; ++v) unassignedVars.insert(v);
+}
+
 // Aktivität einer Variable erhöhen
 void Heuristic::vsidsBump(int v) {
-    if (v <= 0 || v >= static_cast<int>(vsidsActivity.size())) return;
+    if (v <= 0 || v >= static_cast<int>(vsidsActivity.size()) || isEliminated(v)) return;
     vsidsActivity[v] += vsidsVarInc;
 
     // Falls Aktivitäten zu groß werden: Rescaling
@@ -173,10 +186,26 @@ void Heuristic::vsidsDecayInc() {
 
 // Nach Backtrack: Variable wieder in den Heap aufnehmen
 void Heuristic::onBacktrackUnassign(int v) {
-    if (v <= 0 || v >= static_cast<int>(vsidsPos.size())) return;
+    if (v <= 0 || v >= static_cast<int>(vsidsPos.size()) || isEliminated(v)) return;
     if (vsidsPos[v] == -1) heapInsert(v);
 }
 
+// ======================= ELIMINIERTE VARIABLEN =======================
+
+// Variable dauerhaft aus Heap und Random-Menge nehmen
+void Heuristic::eliminateVar(int v) {
+    if (v <= 0) return;
+    if (v >= static_cast<int>(eliminated.size())) eliminated.resize(v + 1, false);
+    eliminated[v] = true;
+    unassignedVars.erase(v);
+    if (v < static_cast<int>(vsidsPos.size()) && vsidsPos[v] != -1) heapRemove(v);
+}
+
+// true, wenn die Variable eliminiert wurde
+bool Heuristic::isEliminated(int v) const {
+    return v > 0 && v < static_cast<int>(eliminated.size()) && eliminated[v];
+}
+
 // ======================= HEAP-OPERATIONEN (für VSIDS) =======================
 
 // Spitze des Heaps zurückgeben (Variable mit höchster Aktivität)
@@ -238,6 +267,21 @@ void Heuristic::heapInsert(int v) {
     heapifyUp(i);
 }
 
+// Variable an beliebiger Position entfernen: mit letztem Element tauschen, dann reparieren
+void Heuristic::heapRemove(int v) {
+    int i = vsidsPos[v];
+    if (i < 0) return;
+    int last = vsidsHeap.back();
+    vsidsHeap.pop_back();
+    vsidsPos[v] = -1;
+    if (last == v) return;
+
+    vsidsHeap[i] = last;
+    vsidsPos[last] = i;
+    heapifyUp(i);
+    heapifyDown(vsidsPos[last]);
+}
+
 // Falls Aktivität erhöht → nach oben korrigieren
 void Heuristic::heapIncreaseKey(int v) {
     int i = vsidsPos[v];
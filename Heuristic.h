@@ -14,8 +14,8 @@ private:
     // Menge aller aktuell unbelegten Variablen (für Random-Heuristik)
     std::set<int> unassignedVars;
 
-    // Zufallsgenerator (für Random). Einmalig statisch initialisiert.
-    static inline std::mt19937_64 rng = std::mt19937_64(std::random_device{}());
+    // Zufallsgenerator (für Random). Pro Instanz, damit parallel laufende Solver sich nicht teilen.
+    std::mt19937_64 rng{std::random_device{}()};
 
     // Jeroslow-Wang: getrennte Scores für positive/negative Literale.
     // Index 0 bleibt unbenutzt, gültig sind 1..numVars.
@@ -34,6 +34,9 @@ private:
     double              vsidsVarInc  = 1.0;
     double              vsidsVarDecay = 0.95;
 
+    // Durch Vorverarbeitung entfernte Variablen (werden nie entschieden)
+    std::vector<bool>   eliminated;
+
 public:
     // Zufalls-Seed setzen (reproduzierbare Random-Auswahl)
     void setSeed(uint64_t s);
@@ -60,6 +63,9 @@ public:
     // VSIDS-Strukturen zurücksetzen/initialisieren
     void initializeVSIDS(int numVars, double decay = 0.95);
 
+    // Variablenbereich auf 1..numVars erweitern (bestehende Aktivitäten/Scores bleiben erhalten)
+    void growVars(int numVars);
+
     // Aktivität einer Variable erhöhen (mit Rescale-Schutz)
     void vsidsBump(int v);
 
@@ -69,6 +75,10 @@ public:
     // Nach Backtrack: Variable wieder in den Heap einfügen, falls nicht enthalten
     void onBacktrackUnassign(int v);
 
+    // Variable aus allen Auswahlstrukturen entfernen (z. B. nach Äquivalenz-Substitution)
+    void eliminateVar(int v);
+    bool isEliminated(int v) const;
+
     // --- VSIDS-Hilfsfunktionen (Heap-Operationen) ---
     // Spitze des Heaps lesen (Variablen-ID) oder -1, wenn leer
     int  heapTop() const;
@@ -80,6 +90,8 @@ public:
     void heapifyDown(int i);
     // Variable in den Heap einfügen
     void heapInsert(int v);
+    // Variable aus dem Heap entfernen (beliebige Position)
+    void heapRemove(int v);
     // Schlüssel von v wurde erhöht -> ggf. nach oben schieben
     void heapIncreaseKey(int v);
 };
@@ -0,0 +1,51 @@
+// IncrementalSolver.cpp
+// ---------------------
+// Dünne Hülle um Solver: Klauseln/Annahmen sammeln, Ergebnis und Modell zwischenspeichern.
+
+#include "IncrementalSolver.h"
+
+IncrementalSolver::IncrementalSolver(HeuristicType heuristic)
+    : solver{std::make_unique<Solver>(0)} {
+    solver->setHeuristic(heuristic);
+    solver->setVerbose(false);
+}
+
+void IncrementalSolver::add(int lit) {
+    if (lit != 0) {
+        clause.push_back(toLiteral(lit));
+        return;
+    }
+    solver->addInputClause(std::move(clause));
+    clause.clear();
+}
+
+void IncrementalSolver::assume(int lit) {
+    if (lit != 0) assumptions.push_back(toLiteral(lit));
+}
+
+int IncrementalSolver::solve() {
+    const bool res = solver->solve(assumptions);
+    assumptions.clear();
+    model.clear();
+
+    if (solver->isInterrupted()) {
+        status = UNKNOWN;
+    } else if (res) {
+        status = SAT;
+        model = solver->getModel();
+    } else {
+        status = UNSAT;
+    }
+    return status;
+}
+
+int IncrementalSolver::val(int lit) const {
+    const int v = lit < 0 ? -lit : lit;
+    if (status != SAT || v >= static_cast<int>(model.size()) || model[v] == -1) return 0;
+    const bool positive = model[v] == 1;
+    return (positive == (lit > 0)) ? lit : -lit;
+}
+
+bool IncrementalSolver::failed(int lit) const {
+    return status == UNSAT && lit != 0 && solver->isFailedAssumption(toLiteral(lit));
+}
@@ -0,0 +1,54 @@
+
+#ifndef INCREMENTALSOLVER_H
+#define INCREMENTALSOLVER_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "Literal.h"
+#include "Solver.h"
+
+// Inkrementelle Schnittstelle nach dem Vorbild von IPASIR.
+// Klauseln werden literalweise aufgebaut (0 schließt eine Klausel ab), Annahmen gelten nur für
+// den nächsten solve()-Aufruf. Der Solver bleibt zwischen den Aufrufen bestehen: gelernte
+// Klauseln, VSIDS-Aktivitäten und gespeicherte Phasen werden weiterverwendet. Variablen
+// werden bei Bedarf angelegt.
+class IncrementalSolver {
+public:
+    static constexpr int SAT     = 10;
+    static constexpr int UNSAT   = 20;
+    static constexpr int UNKNOWN = 0;
+
+    explicit IncrementalSolver(HeuristicType heuristic = HeuristicType::VSIDS);
+
+    // Literal an die aktuelle Klausel anhängen; 0 schließt sie ab
+    void add(int lit);
+    // Annahme für den nächsten solve()-Aufruf
+    void assume(int lit);
+
+    // SAT / UNSAT / UNKNOWN (abgebrochen); die Annahmen werden danach verworfen
+    int  solve();
+
+    // Nach SAT: lit, wenn das Literal wahr ist, sonst -lit (0 = Variable unbekannt)
+    int  val(int lit) const;
+    // Nach UNSAT: true, wenn die Annahme lit an der Widerlegung beteiligt war
+    bool failed(int lit) const;
+
+    // Abbruch von außen (nullptr = keiner)
+    void setTerminate(const std::atomic<bool>* flag) { solver->setStopFlag(flag); }
+
+    // Zugriff auf den zugrunde liegenden Solver (Konfiguration, Statistiken)
+    Solver&       get()       { return *solver; }
+    const Solver& get() const { return *solver; }
+
+private:
+    std::unique_ptr<Solver> solver;
+    std::vector<Literal>    clause;       // Klausel im Aufbau
+    std::vector<Literal>    assumptions;  // Annahmen für den nächsten Aufruf
+    std::vector<int>        model;        // Belegung des letzten SAT-Ergebnisses
+    int                     status = UNKNOWN;
+
+    static Literal toLiteral(int lit) { return Literal(lit < 0 ? -lit : lit, lit < 0); }
+};
+
+#endif // INCREMENTALSOLVER_H
@@ -0,0 +1,170 @@
+// LocalSearch.cpp
+// ---------------
+// ProbSAT mit exponentieller Break-Funktion f(b) = cb^-b. Die Basis cb hängt (wie im
+// Original) von der mittleren Klausellänge ab. Die beste Belegung wird nicht bei jeder
+// Verbesserung vollständig kopiert, sondern über die seitdem geflippten Variablen nachgeführt.
+
+#include "LocalSearch.h"
+
+#include <algorithm>
+#include <cmath>
+
+LocalSearch::LocalSearch(int numVars, uint64_t seed)
+    : numVars{numVars}, rng{seed} {}
+
+void LocalSearch::addClause(const std::vector<Literal>& cl) {
+    for (const auto& l : cl) {
+        lits.push_back(2U * static_cast<uint32_t>(l.getVar()) + (l.isNegated() ? 1U : 0U));
+    }
+    clauseStart.push_back(static_cast<uint32_t>(lits.size()));
+}
+
+// Vorkommenslisten per Counting-Sort aufbauen
+void LocalSearch::buildOccurrences() {
+    const size_t N = 2 * static_cast<size_t>(numVars + 1);
+    occStart.assign(N + 1, 0);
+    for (uint32_t l : lits) ++occStart[l + 1];
+    for (size_t i = 0; i < N; ++i) occStart[i + 1] += occStart[i];
+
+    occ.resize(lits.size());
+    std::vector<uint32_t> fill(occStart.begin(), occStart.end() - 1);
+    for (uint32_t c = 0; c < numClauses(); ++c) {
+        for (uint32_t k = clauseStart[c]; k < clauseStart[c + 1]; ++k) occ[fill[lits[k]]++] = c;
+    }
+}
+
+void LocalSearch::initState(const std::vector<int>& phases) {
+    value.assign(numVars + 1, 0);
+    for (int v = 1; v <= numVars; ++v) {
+        const int p = v < static_cast<int>(phases.size()) ? phases[v] : -1;
+        value[v] = static_cast<uint8_t>(p == -1 ? (rng() & 1U) : p);
+    }
+
+    const size_t m = numClauses();
+    numTrue.assign(m, 0);
+    trueXor.assign(m, 0);
+    breakCount.assign(numVars + 1, 0);
+    unsat.clear();
+    unsatPos.assign(m, 0);
+
+    for (uint32_t c = 0; c < m; ++c) {
+        for (uint32_t k = clauseStart[c]; k < clauseStart[c + 1]; ++k) {
+            const uint32_t v = lits[k] >> 1;
+            if (value[v] != (lits[k] & 1U)) {   // Literal wahr
+                ++numTrue[c];
+                trueXor[c] ^= v;
+            }
+        }
+        if (numTrue[c] == 0) {
+            unsatPos[c] = static_cast<uint32_t>(unsat.size());
+            unsat.push_back(c);
+        } else if (numTrue[c] == 1) {
+            ++breakCount[trueXor[c]];
+        }
+    }
+}
+
+// Variable flippen und Zähler/Break-Werte/Unsat-Liste nachführen
+void LocalSearch::flip(uint32_t var) {
+    value[var] ^= 1U;
+    const uint32_t trueLit  = 2 * var + (value[var] ? 0U : 1U);
+    const uint32_t falseLit = trueLit ^ 1U;
+
+    for (uint32_t i = occStart[trueLit]; i < occStart[trueLit + 1]; ++i) {
+        const uint32_t c = occ[i];
+        trueXor[c] ^= var;
+        if (++numTrue[c] == 1) {
+            // erfüllt: aus der Unsat-Liste entfernen, var ist kritisch
+            const uint32_t last = unsat.back();
+            unsat[unsatPos[c]] = last;
+            unsatPos[last] = unsatPos[c];
+            unsat.pop_back();
+            ++breakCount[var];
+        } else if (numTrue[c] == 2) {
+            // bisher kritische Variable ist es nicht mehr
+            --breakCount[trueXor[c] ^ var];
+        }
+    }
+    for (uint32_t i = occStart[falseLit]; i < occStart[falseLit + 1]; ++i) {
+        const uint32_t c = occ[i];
+        trueXor[c] ^= var;
+        if (--numTrue[c] == 0) {
+            unsatPos[c] = static_cast<uint32_t>(unsat.size());
+            unsat.push_back(c);
+            --breakCount[var];
+        } else if (numTrue[c] == 1) {
+            ++breakCount[trueXor[c]];
+        }
+    }
+}
+
+// Variable der Klausel mit Wahrscheinlichkeit ~ f(break) wählen
+uint32_t LocalSearch::pickVar(uint32_t clause) {
+    const uint32_t begin = clauseStart[clause];
+    const uint32_t end   = clauseStart[clause + 1];
+
+    double sum = 0.0;
+    pickProb.resize(end - begin);
+    for (uint32_t k = begin; k < end; ++k) {
+        const uint32_t b = breakCount[lits[k] >> 1];
+        pickProb[k - begin] = b < probBreak.size() ? probBreak[b] : 0.0;
+        sum += pickProb[k - begin];
+    }
+
+    double r = std::uniform_real_distribution<double>(0.0, sum)(rng);
+    for (uint32_t k = begin; k < end; ++k) {
+        r -= pickProb[k - begin];
+        if (r <= 0.0) return lits[k] >> 1;
+    }
+    return lits[end - 1] >> 1;
+}
+
+LocalSearch::Result LocalSearch::run(std::vector<int>& phases, uint64_t flipLimit) {
+    Result res;
+    if (numClauses() == 0) return res;
+
+    buildOccurrences();
+
+    // cb nach mittlerer Klausellänge (ProbSAT-Empfehlungen für k = 3..7)
+    const double avgLen = static_cast<double>(lits.size()) / static_cast<double>(numClauses());
+    const double cb = avgLen <= 3.5 ? 2.5 : avgLen <= 4.5 ? 3.0 : avgLen <= 5.5 ? 3.7 : avgLen <= 6.5 ? 5.1 : 5.4;
+    probBreak.clear();
+    for (double p = 1.0; p > 1e-30; p /= cb) probBreak.push_back(p);
+
+    initState(phases);
+
+    // Beste Belegung = Belegung + seitdem geflippte Variablen (bei Überlauf: volle Kopie)
+    std::vector<uint8_t>  best = value;
+    std::vector<uint32_t> sinceBest;
+    bool   overflow  = false;
+    size_t bestUnsat = unsat.size();
+
+    for (; res.flips < flipLimit && !unsat.empty(); ++res.flips) {
+        const uint32_t c = unsat[std::uniform_int_distribution<size_t>(0, unsat.size() - 1)(rng)];
+        const uint32_t v = pickVar(c);
+        flip(v);
+
+        if (!overflow) {
+            sinceBest.push_back(v);
+            overflow = sinceBest.size() > static_cast<size_t>(numVars);
+        }
+        if (unsat.size() < bestUnsat) {
+            bestUnsat = unsat.size();
+            if (overflow) {
+                best = value;
+            } else {
+                for (uint32_t x : sinceBest) best[x] = value[x];
+            }
+            sinceBest.clear();
+            overflow = false;
+        }
+    }
+
+    // Nur Variablen zurückschreiben, die in Klauseln vorkommen
+    phases.resize(numVars + 1, -1);
+    for (int v = 1; v <= numVars; ++v) {
+        if (occStart[2 * v + 2] != occStart[2 * v]) phases[v] = best[v];
+    }
+    res.bestUnsat = bestUnsat;
+    return res;
+}
@@ -0,0 +1,62 @@
+
+#ifndef LOCALSEARCH_H
+#define LOCALSEARCH_H
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Literal.h"
+
+// Stochastische lokale Suche (ProbSAT, nur Break-Werte).
+// In jedem Schritt wird eine zufällige unerfüllte Klausel gewählt und darin eine Variable
+// mit Wahrscheinlichkeit ~ f(break) geflippt. Klauseln und Vorkommen liegen flach (CSR) im
+// Speicher; pro Klausel werden #wahrer Literale und das XOR der wahren Variablen gehalten,
+// damit die Break-Werte beim Flip inkrementell aktualisiert werden können.
+class LocalSearch {
+public:
+    struct Result {
+        size_t   bestUnsat = 0;  // #unerfüllter Klauseln der besten Belegung
+        uint64_t flips     = 0;  // durchgeführte Flips
+    };
+
+    LocalSearch(int numVars, uint64_t seed);
+
+    // Klausel übernehmen (keine Duplikate/Tautologien, mindestens ein Literal)
+    void addClause(const std::vector<Literal>& lits);
+
+    size_t numClauses() const { return clauseStart.size() - 1; }
+
+    // Suche ab 'phases' (0/1, -1 = zufällig) bis alle Klauseln erfüllt sind oder
+    // flipLimit erreicht ist. Die beste gefundene Belegung steht danach in 'phases'
+    // (nur für Variablen, die in einer Klausel vorkommen).
+    Result run(std::vector<int>& phases, uint64_t flipLimit);
+
+private:
+    int numVars;
+    std::mt19937_64 rng;
+
+    // Klauseln flach: Literal-Codes 2*var + neg, Klausel i = lits[clauseStart[i] .. clauseStart[i+1])
+    std::vector<uint32_t> lits;
+    std::vector<uint32_t> clauseStart{0};
+
+    // Vorkommen je Literal-Code (CSR): occ[occStart[l] .. occStart[l+1])
+    std::vector<uint32_t> occStart;
+    std::vector<uint32_t> occ;
+
+    // Suchzustand
+    std::vector<uint8_t>  value;      // Belegung je Variable (0/1)
+    std::vector<uint32_t> numTrue;    // #wahrer Literale je Klausel
+    std::vector<uint32_t> trueXor;    // XOR der wahren Variablen (bei numTrue == 1 die kritische)
+    std::vector<uint32_t> breakCount; // #Klauseln, in denen die Variable das einzige wahre Literal ist
+    std::vector<uint32_t> unsat;      // unerfüllte Klauseln
+    std::vector<uint32_t> unsatPos;   // Position in 'unsat' je Klausel
+    std::vector<double>   probBreak;  // f(break), vorberechnet
+    std::vector<double>   pickProb;   // Puffer für pickVar
+
+    void buildOccurrences();
+    void initState(const std::vector<int>& phases);
+    void flip(uint32_t var);
+    uint32_t pickVar(uint32_t clause);
+};
+
+#endif // LOCALSEARCH_H
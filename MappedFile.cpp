@@ -0,0 +1,50 @@
+// MappedFile.cpp
+// --------------
+// mmap mit sequenziellem Zugriffshinweis; Fallback über std::ifstream.
+
+#include "MappedFile.h"
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GUMS_HAVE_MMAP 1
+#endif
+
+MappedFile::~MappedFile() {
+#ifdef GUMS_HAVE_MMAP
+    if (mapped) munmap(const_cast<char*>(begin), length);
+#endif
+}
+
+bool MappedFile::open(const std::filesystem::path& path) {
+#ifdef GUMS_HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st {};
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void* p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            madvise(p, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+            begin  = static_cast<const char*>(p);
+            length = static_cast<size_t>(st.st_size);
+            mapped = true;
+            ::close(fd);
+            return true;
+        }
+    }
+    ::close(fd);
+#endif
+
+    // Fallback: vollständig einlesen
+    std::ifstream ifs{path, std::ios::binary};
+    if (!ifs.is_open()) return false;
+    fallback.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    begin  = fallback.data();
+    length = fallback.size();
+    return true;
+}
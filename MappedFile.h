@@ -0,0 +1,33 @@
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+// Read-only Sicht auf eine Datei im Speicher.
+// Unter POSIX per mmap (keine Kopie, Seiten werden bei Bedarf vom Kernel geladen);
+// falls mmap nicht verfügbar ist oder fehlschlägt, wird die Datei in einen Puffer gelesen.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Datei öffnen und abbilden. false = Datei nicht lesbar
+    bool open(const std::filesystem::path& path);
+
+    const char* data() const { return begin; }
+    size_t      size() const { return length; }
+
+private:
+    const char*       begin  = nullptr;
+    size_t            length = 0;
+    bool              mapped = false;  // true = munmap im Destruktor
+    std::vector<char> fallback;        // Inhalt, falls nicht gemappt
+};
+
+#endif // MAPPEDFILE_H
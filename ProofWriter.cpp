@@ -0,0 +1,93 @@
+// ProofWriter.cpp
+// ---------------
+// Binäres DRAT. Ein Eintrag ist höchstens 1 + 5 * (k + 1) Byte lang; der Puffer wird
+// abgegeben, sobald der nächste Eintrag nicht mehr sicher hineinpasst.
+
+#include "ProofWriter.h"
+
+ProofWriter::ProofWriter(size_t bufferSize) : capacity{bufferSize < 4096 ? 4096 : bufferSize} {}
+
+ProofWriter::~ProofWriter() {
+    close();
+}
+
+bool ProofWriter::open(const std::filesystem::path& path, bool runAsync) {
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+    buf.reserve(capacity);
+    async = runAsync;
+    if (async) {
+        pending.reserve(capacity);
+        writer = std::thread(&ProofWriter::writerLoop, this);
+    }
+    return true;
+}
+
+void ProofWriter::put(char kind, const std::vector<Literal>& lits) {
+    if (!out.is_open()) return;
+    if (buf.size() + 1 + 5 * (lits.size() + 1) > capacity) flush();
+
+    buf.push_back(kind);
+    for (const auto& l : lits) {
+        uint32_t x = 2 * static_cast<uint32_t>(l.getVar()) + (l.isNegated() ? 1U : 0U);
+        while (x > 0x7f) {
+            buf.push_back(static_cast<char>((x & 0x7f) | 0x80));
+            x >>= 7;
+        }
+        buf.push_back(static_cast<char>(x));
+    }
+    buf.push_back(0);
+}
+
+void ProofWriter::flush() {
+    if (buf.empty()) return;
+    written += buf.size();
+    if (!async) {
+        out.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        buf.clear();
+        return;
+    }
+
+    // Warten, bis der Thread den vorherigen Puffer geschrieben hat, dann tauschen
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&] { return !hasPending; });
+    pending.swap(buf);
+    hasPending = true;
+    lock.unlock();
+    cv.notify_all();
+    buf.clear();
+}
+
+void ProofWriter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        cv.wait(lock, [&] { return hasPending || stopping; });
+        if (!hasPending) return;
+
+        lock.unlock();
+        out.write(pending.data(), static_cast<std::streamsize>(pending.size()));
+        const bool ok = out.good();
+        pending.clear();
+        lock.lock();
+        failed = failed || !ok;
+        hasPending = false;
+        cv.notify_all();
+    }
+}
+
+bool ProofWriter::close() {
+    if (!out.is_open()) return !failed;
+    flush();
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        writer.join();
+    }
+    out.flush();
+    const bool ok = out.good() && !failed;
+    out.close();
+    return ok;
+}
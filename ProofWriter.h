@@ -0,0 +1,59 @@
+
+#ifndef PROOFWRITER_H
+#define PROOFWRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Literal.h"
+
+// DRAT-Beweis im Binärformat (wie von drat-trim erwartet):
+//   'a' bzw. 'd', dann je Literal 2*var + neg als 7-Bit-Varint, abgeschlossen mit 0.
+// Geschrieben wird über einen großen Puffer. Asynchron übernimmt ein Hintergrund-Thread
+// den vollen Puffer, während der Solver in den zweiten weiterschreibt (Doppelpuffer).
+class ProofWriter {
+public:
+    explicit ProofWriter(size_t bufferSize = size_t{1} << 22);
+    ~ProofWriter();
+
+    ProofWriter(const ProofWriter&) = delete;
+    ProofWriter& operator=(const ProofWriter&) = delete;
+
+    // Datei anlegen (überschreibt). async = Hintergrund-Thread für die Schreibzugriffe
+    bool open(const std::filesystem::path& path, bool async);
+
+    void add(const std::vector<Literal>& lits) { put('a', lits); }
+    void remove(const std::vector<Literal>& lits) { put('d', lits); }
+
+    // Restpuffer schreiben, Thread beenden, Datei schließen. false = Schreibfehler
+    bool close();
+
+    bool     isOpen() const { return out.is_open(); }
+    uint64_t bytesWritten() const { return written; }
+
+private:
+    void put(char kind, const std::vector<Literal>& lits);
+    void flush();            // vollen Puffer abgeben (synchron schreiben oder an den Thread)
+    void writerLoop();
+
+    std::ofstream     out;
+    std::vector<char> buf;   // wird vom Solver gefüllt
+    size_t            capacity;
+    uint64_t          written = 0;
+
+    // Doppelpuffer für den asynchronen Modus: 'pending' gehört dem Thread, solange hasPending
+    bool                    async = false;
+    std::thread             writer;
+    std::mutex              mtx;
+    std::condition_variable cv;
+    std::vector<char>       pending;
+    bool                    hasPending = false;
+    bool                    stopping   = false;
+    bool                    failed     = false;
+};
+
+#endif // PROOFWRITER_H
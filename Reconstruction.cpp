@@ -0,0 +1,31 @@
+// Reconstruction.cpp
+// -------------------
+// Modell-Rekonstruktion für Vorverarbeitungen, die Klauseln oder Variablen
+// entfernen (Äquivalenz-Substitution, Blocked Clause Elimination).
+
+#include "Reconstruction.h"
+
+// Entfernte Klausel mit ihrem Pivot-Literal auf den Stapel legen
+void Reconstruction::push(const Literal& pivot, std::vector<Literal> lits) {
+    stack.push_back({pivot, std::move(lits)});
+}
+
+// Einträge eines anderen Stapels anhängen
+void Reconstruction::append(const Reconstruction& other) {
+    stack.insert(stack.end(), other.stack.begin(), other.stack.end());
+}
+
+// Rückwärts über den Stapel: nicht erfüllte Klausel → Pivot wahr setzen.
+// Unbelegte Literale zählen dabei als nicht erfüllt.
+void Reconstruction::extend(std::vector<int>& assignment) const {
+    for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+        bool satisfied = false;
+        for (const auto& l : it->lits) {
+            const int a = assignment[l.getVar()];
+            if (a != -1 && (a == 1) != l.isNegated()) { satisfied = true; break; }
+        }
+        if (!satisfied) {
+            assignment[it->pivot.getVar()] = it->pivot.isNegated() ? 0 : 1;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef RECONSTRUCTION_H
+#define RECONSTRUCTION_H
+
+#include <vector>
+#include "Literal.h"
+
+// Stapel entfernter Klauseln für die Modell-Rekonstruktion.
+// Jeder Eintrag besteht aus einem Pivot-Literal und der entfernten Klausel.
+// Beim Erweitern eines Modells wird der Stapel rückwärts abgearbeitet: ist eine
+// Klausel unter dem aktuellen Modell nicht erfüllt, wird ihr Pivot wahr gesetzt.
+class Reconstruction {
+private:
+    struct Entry {
+        Literal              pivot; // Literal, das bei Bedarf wahr gesetzt wird
+        std::vector<Literal> lits;  // entfernte Klausel (enthält pivot)
+    };
+
+    std::vector<Entry> stack;
+
+public:
+    // Entfernte Klausel mit Pivot-Literal vormerken
+    void push(const Literal& pivot, std::vector<Literal> lits);
+
+    // Einträge eines anderen Stapels anhängen (dessen Einträge werden danach zuerst rückgängig gemacht)
+    void append(const Reconstruction& other);
+
+    bool   empty() const { return stack.empty(); }
+    size_t size()  const { return stack.size(); }
+
+    // Modell erweitern: assignment[v] = -1 (unbelegt), 0 (false), 1 (true); Index 0 unbenutzt
+    void extend(std::vector<int>& assignment) const;
+};
+
+#endif // RECONSTRUCTION_H
@@ -1,13 +1,31 @@
 #include "Solver.h"
+#include "Subsumption.h"
+#include "LocalSearch.h"
 #include "Timer.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <iterator>
 #include <iostream>
 #include <cassert>
+#include <unordered_map>
 #include <unordered_set>
 #include <iomanip>
 #include <fstream>
 
+// Bucht die Konflikte, die propagate() innerhalb eines Inprocessing-Durchlaufs zählt, beim
+// Verlassen des Gültigkeitsbereichs auf einen eigenen Zähler um: stats.conflicts (und damit
+// das Konfliktbudget conflictLimit) enthält nur Konflikte der Suche
+struct ConflictRedirect {
+    uint64_t& conflicts;
+    uint64_t& target;
+    const uint64_t before = conflicts;
+    ~ConflictRedirect() {
+        target += conflicts - before;
+        conflicts = before;
+    }
+};
+
 // Luby-Folge (i >= 1):
 // Liefert das i-te Element der Luby-Sequenz (für Restart-Budgets).
 int luby(int i) {
@@ -31,7 +49,11 @@ int luby(int i) {
 Solver::Solver(int n)
         : numVars(n),
           assignment(numVars + 1, -1),   // -1 = unbelegt; Index 0 bleibt ungenutzt
-          savedPhase(numVars + 1, -1)    // -1 = keine gespeicherte Phase
+          savedPhase(numVars + 1, -1),   // -1 = keine gespeicherte Phase
+          eliminated(numVars + 1, false),
+          substitutedBy(numVars + 1, Literal(0, false)),
+          frozen(numVars + 1, false),
+          lazyKind(numVars + 1, LazyKind::NONE)
 {
     // Random-Grundinitialisierung (für Random-Heuristik)
     heuristic.initialize(numVars);
@@ -44,19 +66,30 @@ Solver::Solver(int n)
 
     // Für jedes Literal eine Watch-Liste: pos/neg → 2 pro Variable
     watchList.assign(2 * numVars, {});
+    amoOcc.assign(2 * numVars, {});
 
     // Restart-Budget initialisieren (Luby)
-    restart_budget = restart_base * luby(restart_idx);
+    restart_budget = restartBudget();
     conflicts_since_restart = 0;
 }
 
 // Hauptschleife des Solvers
 bool Solver::solve() {
+    return solve({});
+}
+
+// Einmalige Vorverarbeitung (erster solve()-Aufruf)
+bool Solver::prepare() {
+    PROFILE_SCOPE(stats.t_prepare_ns);
     // Optional Puffer für gelernte Klauseln (reduziert Reallocs)
     if (!clauses.empty()) clauses.reserve(clauses.size() + 1024);
 
-    // Bestehende Klauseln an Watch-Listen hängen
-    attachExistingClauses();
+    // Leere Klausel (z. B. durch Self-Subsuming Resolution entstanden) → UNSAT
+    if (std::ranges::any_of(clauses, [](const Clause& c) { return c.size() == 0; })) return false;
+
+    // Watch-Listen für alle Klauseln einmalig aufbauen (auch über addClause
+    // hinzugefügte Klauseln werden dabei nicht doppelt eingetragen)
+    rebuildWatchLists();
     // Unit-Klauseln (Level 0) vorab in den Trail
     seedRootUnits();
 
@@ -65,21 +98,69 @@ bool Solver::solve() {
         heuristic.initializeJeroslowWang(clauses, numVars);
     }
 
+    // Root-Level propagieren, danach Failed-Literal-Probing als Preprocessing
+    if (propagate() != nullptr) return false;
+    if (!probe(probe_budget_pre)) return false;
+
+    // Äquivalente Literale substituieren (entfernt ganze Variablen)
+    if (!substituteEquivalences()) return false;
+
+    // XOR-Constraints erkennen und per Gauß-Elimination mitpropagieren (nicht mit Beweis)
+    if (proof == nullptr) initGauss();
+    if (propagate() != nullptr) return false;
+
+    // Startphasen aus lokaler Suche
+    localSearchPhases(ls_flips_pre, ls_flips_per_clause_pre);
+    return true;
+}
+
+bool Solver::solve(const std::vector<Literal>& assume) {
+    PROFILE_SCOPE(stats.t_search_ns);
+    interrupted = false;
+    failedAssumptions.clear();
+    if (rootUnsat) return false;
+    if (!prepared) {
+        prepared = true;
+        if (!prepare()) {
+            markRootUnsat();
+            return false;
+        }
+    } else if (!resumeSearch) {
+        backtrackToLevel(0);
+    }
+    resumeSearch = false;
+    std::vector<Literal> mapped;
+    for (const auto& a : assume) {
+        reserveVars(a.getVar());
+        mapped.push_back(assumptionLiteral(a));
+    }
+    // Weitersuchen nach blockModel() nur unter denselben Annahmen
+    if (decisionLevel > 0 && mapped != assumptions) backtrackToLevel(0);
+    assumptions = std::move(mapped);
+    const uint64_t conflictStop = conflictLimit != 0 ? stats.conflicts + conflictLimit : UINT64_MAX;
+
     // CDCL-Schleife
     while (true) {
+        // Abbruch von außen (z. B. eine andere Komponente ist UNSAT) oder Konfliktbudget erschöpft
+        if ((stopFlag != nullptr && stopFlag->load(std::memory_order_relaxed)) || stats.conflicts >= conflictStop) {
+            interrupted = true;
+            return false;
+        }
+
         // BCP (Two-Watched-Literals)
         Clause* conflict = propagate();
         if (conflict != nullptr) {
             // Konflikt auf Root-Level → UNSAT
-            if (decisionLevel == 0) return false;
+            if (decisionLevel == 0) {
+                markRootUnsat();
+                return false;
+            }
 
             // 1-UIP Analyse → (gelernte Klausel, Backjump-Level, assertierendes Literal)
             auto [learnedClause, backjumpLevel, assertLit] = analyzeConflict(conflict);
 
-            // Backjump
-            backtrackToLevel(backjumpLevel);
-
-            // LBD der gelernten Klausel bestimmen + Stats aktualisieren
+            // LBD der gelernten Klausel bestimmen (vor dem Backjump, solange alle
+            // Literale noch belegt sind) + Stats aktualisieren
             const int lbd = learnedClause.computeLBD(trail);
             learnedClause.setLBD(lbd);
             stats.learnt_lbd_sum += static_cast<uint64_t>(lbd);
@@ -88,6 +169,9 @@ bool Solver::solve() {
             else if (lbd <= 4) stats.learnt_lbd_3_4++;
             else               stats.learnt_lbd_ge5++;
 
+            // Backjump
+            backtrackToLevel(backjumpLevel);
+
             // Reorder: assertierendes Literal an Position 0 (üblich für BCP)
             {
                 std::vector<Literal> tmp;
@@ -98,22 +182,29 @@ bool Solver::solve() {
                         tmp.push_back(l);
                 }
                 learnedClause = Clause(std::move(tmp));
+                learnedClause.setLearnt(true); // Flag + LBD gehen beim Neuaufbau sonst verloren
+                learnedClause.setLBD(lbd);
             }
 
-            // Gelernte Klausel hinzufügen (inkl. Watches) + ggf. Datenbank reduzieren
+            // Gelernte Klausel hinzufügen (inkl. Watches)
+            if (proof != nullptr) proofAdd(learnedClause.getClause());
             addClause(learnedClause);
             stats.learnts_added++;
-            if ((stats.learnts_added % 200) == 0) {
-                reduceDB();
-            }
+            if (exchange != nullptr) exportLearnt(learnedClause);
             int reason_idx = static_cast<int>(clauses.size()) - 1;
 
             // Assertierendes Literal direkt setzen (am Backjump-Level)
             assign(assertLit, backjumpLevel, reason_idx);
+
+            // Datenbank erst danach reduzieren: die neue Klausel ist nun Reason (locked)
+            if (stats.learnts_added >= next_reduce) {
+                next_reduce += reduce_base + reduce_inc * (++reduce_count);
+                reduceDB();
+            }
             conflicts_since_restart++;
 
             // Seltene Statusausgabe (alle 1000 Konflikte)
-            if ((stats.conflicts % 1000) == 0) {
+            if (verbose && (stats.conflicts % 1000) == 0) {
                 double lbd_avg = stats.learnt_lbd_count
                     ? (double)stats.learnt_lbd_sum / (double)stats.learnt_lbd_count
                     : 0.0;
@@ -128,23 +219,43 @@ bool Solver::solve() {
 
             // Restart nach Budget (Luby)
             if (conflicts_since_restart >= restart_budget) {
+                PROFILE_SCOPE(stats.t_restart_ns);
                 backtrackToLevel(0);
                 restart_idx++;
-                restart_budget = restart_base * luby(restart_idx);
+                restart_budget = restartBudget();
                 conflicts_since_restart = 0;
                 stats.restarts++;
+                if ((exchange != nullptr && !importShared()) || !inprocess()) {
+                    markRootUnsat();
+                    return false;
+                }
                 continue;
             }
             continue; // nach Konflikt weiter propagieren
         }
+        else if (decisionLevel < static_cast<int>(assumptions.size())) {
+            // Annahmen zuerst, je eine eigene Ebene (bereits wahre Annahme: leere Ebene)
+            const Literal a = assumptions[decisionLevel];
+            const int val = assignment[a.getVar()];
+            if (val != -1 && (val == 1) == a.isNegated()) { // Annahme widerlegt
+                analyzeFinal(a);
+                return false;
+            }
+            decisionLevel++;
+            if (val == -1) assign(a, decisionLevel, -1);
+        }
         else if (allVariablesAssigned()) {
             // Keine Konflikte und alles belegt → SAT
             return true;
         }
         else {
+            // Modell der lokalen Suche direkt übernehmen (wird dabei vollständig geprüft)
+            if (!lsModel.empty() && installLocalSearchModel()) return true;
+
             // Branching-Entscheidung treffen
             Literal decision = pickBranchingVariable();
             decisionLevel++;
+            stats.decisions++;
             assign(decision, decisionLevel, -1); // -1 = Entscheidung (keine Reason-Klausel)
         }
     }
@@ -224,12 +335,9 @@ Clause* Solver::unitPropagation() {
 
 // Literal in den Trail schreiben, Stats pflegen, Phase speichern
 void Solver::assign(const Literal& lit, int level, int reason_idx) {
-    // Entscheidung vs. Propagation
-    if (reason_idx == -1) {
-        stats.decisions++;
-    } else {
-        stats.propagations++;
-    }
+    // Propagationen zählen (Entscheidungen zählt die Suchschleife: Annahmen, Probing und
+    // Vivifikation setzen ebenfalls Literale ohne Reason)
+    if (reason_idx != -1) stats.propagations++;
     // In den Trail (enqueue)
     trail.assign(lit, level, reason_idx);
     // Belegung setzen
@@ -240,7 +348,7 @@ void Solver::assign(const Literal& lit, int level, int reason_idx) {
 
 // Konfliktanalyse (1-UIP): gelernte Klausel, Backjump-Level, assertierendes Literal
 std::tuple<Clause,int,Literal> Solver::analyzeConflict(const Clause* conflict) {
-    ScopedTimer _t(stats.t_analyze_ms);   // Analysezeit messen
+    PROFILE_SCOPE(stats.t_analyze_ns);    // Analysezeit messen
     decayClauseInc(); // pro Konflikt genau einmal das Klausel-Inkrement zerfallen lassen
     Clause learnedClause = *conflict;     // Start mit Konfliktklausel
 
@@ -289,6 +397,11 @@ std::tuple<Clause,int,Literal> Solver::analyzeConflict(const Clause* conflict) {
         int reason_idx = trail.getReasonIndexOfVar(resolveLit.getVar());
         const Clause* reason = (reason_idx >= 0 && reason_idx < static_cast<int>(clauses.size()))
                              ? &clauses[reason_idx] : nullptr;
+        Clause lazyReason;
+        if (reason_idx == Trail::LAZY_REASON) {
+            lazyReason = explainLazyReason(resolveLit.getVar());
+            reason = &lazyReason;
+        }
         if (!reason) break; // defensiv
 
         // Reason-Klausel aktivieren (Clause-Aktivität erhöhen)
@@ -367,6 +480,16 @@ void Solver::backtrackToLevel(int level) {
         if (currentHeuristic == HeuristicType::VSIDS) {
             heuristic.onBacktrackUnassign(var);
         }
+        // Gauß-Matrix: Spalte wieder unbelegt
+        if (xorEngine.active()) xorEngine.unassign(var);
+        // AMO: war die Variable das wahre Literal eines Constraints, ist er wieder frei
+        if (!amos.empty()) {
+            for (const Literal l : {Literal(var, false), Literal(var, true)}) {
+                for (int id : amoOcc[litToIndex(l)]) {
+                    if (amoTrue[id] == l) amoTrue[id] = Literal(0, false);
+                }
+            }
+        }
     }
 
     decisionLevel = level;
@@ -375,17 +498,33 @@ void Solver::backtrackToLevel(int level) {
     if (qhead > trail.getTrail().size()) {
         qhead = trail.getTrail().size();
     }
+    if (xorHead > trail.getTrail().size()) {
+        xorHead = trail.getTrail().size();
+    }
 }
 
 // Watch-Listen für bereits existierende Klauseln aufbauen
 void Solver::attachExistingClauses() {
-    for (size_t idx = 0; idx < clauses.size(); ++idx){
-        auto& c = clauses[idx];
-        // Default-Watches setzen, falls noch nicht initialisiert
+    // 1. Durchgang: Default-Watches setzen, falls noch nicht initialisiert, und zählen
+    std::vector<size_t> count(watchList.size(), 0);
+    for (auto& c : clauses) {
         if (c.size() > 0 && (c.watch0() == -1 || c.watch1() == -1)) {
             c.initWatchesDefault();
         }
-        // An die entsprechenden Watch-Listen hängen
+        if (c.size() == 1) {
+            ++count[litToIndex(c.at(0))];
+        } else {
+            if (c.watch0() != -1) ++count[litToIndex(c.at(c.watch0()))];
+            if (c.watch1() != -1) ++count[litToIndex(c.at(c.watch1()))];
+        }
+    }
+    for (size_t i = 0; i < watchList.size(); ++i) {
+        watchList[i].reserve(watchList[i].size() + count[i]);
+    }
+
+    // 2. Durchgang: an die entsprechenden Watch-Listen hängen
+    for (size_t idx = 0; idx < clauses.size(); ++idx){
+        const auto& c = clauses[idx];
         if (c.size() == 1) {
             attachClause(idx, c.at(0)); // Unit: nur einmal attachen
         } else {
@@ -397,6 +536,7 @@ void Solver::attachExistingClauses() {
 
 // Branching-Variable wählen (abhängig von der Heuristik)
 Literal Solver::pickBranchingVariable() {
+    PROFILE_SCOPE(stats.t_decide_ns);
     int  var        = -1;   // gewählte Variable
     bool useNegated = false; // gewählte Polarität (true = negiert)
     bool jwNegHint  = false; // JW-Empfehlung, nur wenn keine Phase gespeichert
@@ -442,10 +582,10 @@ Literal Solver::pickBranchingVariable() {
     }
 
     // Sicherheits-Fallback: erste unbelegte Variable nehmen
-    if (var <= 0 || var > numVars || assignment[var] != -1) {
+    if (var <= 0 || var > numVars || assignment[var] != -1 || eliminated[var]) {
         var = -1;
-        for (int v = 1; v <= numVars; ++v) {
-            if (assignment[v] == -1) { var = v; break; }
+        for (int v = 1; v <= numVars && var == -1; ++v) {
+            if (assignment[v] == -1 && !eliminated[v]) var = v;
         }
         if (var == -1) var = 1;
     }
@@ -470,7 +610,7 @@ void Solver::setHeuristic(HeuristicType type) {
 // Prüfen, ob alle Variablen belegt sind
 bool Solver::allVariablesAssigned() const {
     for (int i = 1; i <= numVars; ++i)
-        if (assignment[i] == -1) return false;
+        if (assignment[i] == -1 && !eliminated[i]) return false;
     return true;
 }
 
@@ -492,8 +632,8 @@ void Solver::addClause(const Clause& clause) {
         if (c.watch1() != -1) attachClause(idx, c.at(c.watch1()));
     }
 
-    // LBD nachtragen, falls noch nicht gesetzt (z. B. bei Input-Klauseln)
-    if (c.getLBD() < 0) {
+    // LBD nachtragen, falls noch nicht gesetzt (nur für gelernte Klauseln relevant)
+    if (c.isLearnt() && c.getLBD() < 0) {
         c.setLBD(c.computeLBD(trail));
     }
 
@@ -503,15 +643,56 @@ void Solver::addClause(const Clause& clause) {
     }
 }
 
+void Solver::loadClauses(std::vector<Clause>&& input) {
+    if (clauses.empty()) {
+        clauses = std::move(input);
+    } else {
+        clauses.reserve(clauses.size() + input.size());
+        std::move(input.begin(), input.end(), std::back_inserter(clauses));
+    }
+    input.clear();
+}
+
 // Modell ausgeben (Debug/Info)
 void Solver::printModel() const {
+    const std::vector<int> model = getModel();
     for (int i = 1; i <= numVars; ++i) {
         std::cout << "x" << i << " = "
-        << (assignment[i] == -1 ? "Unassigned"
-            : (assignment[i] == 1 ? "True" : "False")) << "\n";
+        << (model[i] == -1 ? "Unassigned"
+            : (model[i] == 1 ? "True" : "False")) << "\n";
     }
 }
 
+// Aktuelle Belegung, erweitert um die Werte eliminierter Variablen
+std::vector<int> Solver::getModel() const {
+    std::vector<int> model = assignment;
+    reconstruction.extend(model);
+    return model;
+}
+
+Stats& Stats::operator+=(const Stats& o) {
+    decisions += o.decisions; conflicts += o.conflicts; propagations += o.propagations;
+    learnts_added += o.learnts_added; restarts += o.restarts;
+    clause_inspections += o.clause_inspections; watch_moves += o.watch_moves;
+    t_search_ns += o.t_search_ns; t_prepare_ns += o.t_prepare_ns; t_bcp_ns += o.t_bcp_ns;
+    t_analyze_ns += o.t_analyze_ns; t_decide_ns += o.t_decide_ns; t_reduce_ns += o.t_reduce_ns;
+    t_restart_ns += o.t_restart_ns; learnt_lbd_sum += o.learnt_lbd_sum;
+    learnt_lbd_count += o.learnt_lbd_count; learnt_lbd_le2 += o.learnt_lbd_le2;
+    learnt_lbd_3_4 += o.learnt_lbd_3_4; learnt_lbd_ge5 += o.learnt_lbd_ge5;
+    deleted_count += o.deleted_count; deleted_lbd_sum += o.deleted_lbd_sum;
+    subsumed_learnts += o.subsumed_learnts; strengthened_learnts += o.strengthened_learnts;
+    probe_failed += o.probe_failed; probe_implied += o.probe_implied; probe_hbr += o.probe_hbr;
+    probe_conflicts += o.probe_conflicts; els_substituted += o.els_substituted;
+    vivify_checked += o.vivify_checked; vivify_shrunk += o.vivify_shrunk; vivify_lits += o.vivify_lits;
+    vivify_conflicts += o.vivify_conflicts; xor_constraints += o.xor_constraints;
+    xor_props += o.xor_props; xor_conflicts += o.xor_conflicts; amo_constraints += o.amo_constraints;
+    amo_props += o.amo_props; amo_conflicts += o.amo_conflicts; ls_runs += o.ls_runs;
+    ls_flips += o.ls_flips; ls_best_unsat += o.ls_best_unsat; ls_solved += o.ls_solved;
+    shared_exported += o.shared_exported; shared_imported += o.shared_imported;
+    models_blocked += o.models_blocked; proof_added += o.proof_added; proof_deleted += o.proof_deleted;
+    return *this;
+}
+
 // Statistiken ausgeben
 void Solver::printStats() const {
     std::cout << "\n========== Solver Statistics ==========\n";
@@ -521,8 +702,6 @@ void Solver::printStats() const {
     std::cout << std::left << std::setw(20) << "Learnts added:"   << stats.learnts_added << "\n";
     std::cout << std::left << std::setw(20) << "Inspections:"     << stats.clause_inspections << "\n";
     std::cout << std::left << std::setw(20) << "Watch moves:"     << stats.watch_moves << "\n";
-    std::cout << std::left << std::setw(20) << "BCP time (ms):"   << stats.t_bcp_ms << "\n";
-    std::cout << std::left << std::setw(20) << "Analyze time (ms):" << stats.t_analyze_ms << "\n";
     std::cout << std::left << std::setw(20) << "Restarts:"        << stats.restarts << "\n";
     std::cout << std::left << std::setw(20) << "LBD avg:"         << (stats.learnt_lbd_count ? (double)stats.learnt_lbd_sum / (double)stats.learnt_lbd_count : 0.0) << "\n";
     std::cout << std::left << std::setw(20) << "LBD <= 2:"        << stats.learnt_lbd_le2 << "\n";
@@ -530,7 +709,57 @@ void Solver::printStats() const {
     std::cout << std::left << std::setw(20) << "LBD >= 5:"        << stats.learnt_lbd_ge5 << "\n";
     std::cout << std::left << std::setw(20) << "Deleted clauses:" << stats.deleted_count << "\n";
     std::cout << std::left << std::setw(20) << "Deleted LBD sum:" << stats.deleted_lbd_sum << "\n";
+    std::cout << std::left << std::setw(20) << "Subsumed learnts:" << stats.subsumed_learnts << "\n";
+    std::cout << std::left << std::setw(20) << "Strengthened lits:" << stats.strengthened_learnts << "\n";
+    std::cout << std::left << std::setw(20) << "Failed literals:" << stats.probe_failed << "\n";
+    std::cout << std::left << std::setw(20) << "Probe units:"     << stats.probe_implied << "\n";
+    std::cout << std::left << std::setw(20) << "HBR binaries:"    << stats.probe_hbr << "\n";
+    std::cout << std::left << std::setw(20) << "Probe conflicts:" << stats.probe_conflicts << "\n";
+    std::cout << std::left << std::setw(20) << "Substituted vars:" << stats.els_substituted << "\n";
+    std::cout << std::left << std::setw(20) << "Vivify checked:"  << stats.vivify_checked << "\n";
+    std::cout << std::left << std::setw(20) << "Vivify shrunk:"   << stats.vivify_shrunk << "\n";
+    std::cout << std::left << std::setw(20) << "Vivify lits:"     << stats.vivify_lits << "\n";
+    std::cout << std::left << std::setw(20) << "Vivify conflicts:" << stats.vivify_conflicts << "\n";
+    std::cout << std::left << std::setw(20) << "XOR constraints:" << stats.xor_constraints << "\n";
+    std::cout << std::left << std::setw(20) << "XOR propagations:" << stats.xor_props << "\n";
+    std::cout << std::left << std::setw(20) << "XOR conflicts:"   << stats.xor_conflicts << "\n";
+    std::cout << std::left << std::setw(20) << "AMO constraints:" << stats.amo_constraints << "\n";
+    std::cout << std::left << std::setw(20) << "AMO propagations:" << stats.amo_props << "\n";
+    std::cout << std::left << std::setw(20) << "AMO conflicts:"   << stats.amo_conflicts << "\n";
+    std::cout << std::left << std::setw(20) << "LS runs:"         << stats.ls_runs << "\n";
+    std::cout << std::left << std::setw(20) << "LS flips:"        << stats.ls_flips << "\n";
+    std::cout << std::left << std::setw(20) << "LS best unsat:"   << stats.ls_best_unsat << "\n";
+    std::cout << std::left << std::setw(20) << "LS solved:"       << stats.ls_solved << "\n";
+    std::cout << std::left << std::setw(20) << "Shared exported:" << stats.shared_exported << "\n";
+    std::cout << std::left << std::setw(20) << "Shared imported:" << stats.shared_imported << "\n";
+    std::cout << std::left << std::setw(20) << "Models blocked:"  << stats.models_blocked << "\n";
+    std::cout << std::left << std::setw(20) << "Proof lemmas:"    << stats.proof_added << "\n";
+    std::cout << std::left << std::setw(20) << "Proof deletions:" << stats.proof_deleted << "\n";
     std::cout << std::left << std::setw(20) << "Heuristic:"       << heuristicToString(currentHeuristic) << "\n";
+
+    // Laufzeitprofil: Zeit je Phase (ms) und Anteil an Einlesen + solve(); die Phasen
+    // unterhalb von "Solve time" ergeben zusammen 100 % der Zeit in solve()
+#if GUMS_PROFILE
+    const double total = static_cast<double>(stats.t_parse_ns + stats.solveNs());
+    auto phase = [&](const std::string& label, uint64_t ns) {
+        std::cout << std::left << std::setw(20) << label << std::fixed << std::setprecision(3)
+                  << static_cast<double>(ns) / 1e6 << " (" << std::setprecision(1)
+                  << (total > 0 ? 100.0 * static_cast<double>(ns) / total : 0.0) << " %)\n"
+                  << std::defaultfloat << std::setprecision(6);
+    };
+    std::cout << "--------- Profile (ms, share) ---------\n";
+    phase("Parse time:",      stats.t_parse_ns);
+    phase("Solve time:",      stats.solveNs());
+    phase("Search loop:",     stats.t_search_ns);
+    phase("Prepare time:",    stats.t_prepare_ns);
+    phase("BCP time:",        stats.t_bcp_ns);
+    phase("Analyze time:",    stats.t_analyze_ns);
+    phase("Decide (" + heuristicToString(currentHeuristic) + "):", stats.t_decide_ns);
+    phase("ReduceDB time:",   stats.t_reduce_ns);
+    phase("Restart time:",    stats.t_restart_ns);
+#else
+    std::cout << "Profile:            disabled (GUMS_PROFILE=0)\n";
+#endif
     std::cout << "=======================================\n\n";
 }
 
@@ -542,14 +771,32 @@ void Solver::exportStats(const std::string& filename) const {
         return;
     }
 
-    csv_file << "Decisions;Conflicts;Propagations;Learnts_added;Inspections;Watch_moves;BCP_time_(ms);Analzye_time_(ms);Restarts;LBD_avg;LBD_<=_2;LBD_3-4;LBD_>=_5;Deleted_clauses;Deleted_LBD_sum;Heuristic\n";
+    csv_file << "Decisions;Conflicts;Propagations;Learnts_added;Inspections;Watch_moves;BCP_time_(ms);Analzye_time_(ms);Restarts;LBD_avg;LBD_<=_2;LBD_3-4;LBD_>=_5;Deleted_clauses;Deleted_LBD_sum;Subsumed_learnts;Strengthened_lits;Failed_literals;Probe_units;HBR_binaries;Probe_conflicts;Substituted_vars;Vivify_checked;Vivify_shrunk;Vivify_lits;Vivify_conflicts;XOR_constraints;XOR_propagations;XOR_conflicts;AMO_constraints;AMO_propagations;AMO_conflicts;LS_runs;LS_flips;LS_best_unsat;LS_solved;Shared_exported;Shared_imported;Models_blocked;Proof_lemmas;Proof_deletions;Parse_time_(ms);Solve_time_(ms);Search_time_(ms);Prepare_time_(ms);Decide_time_(ms);ReduceDB_time_(ms);Restart_time_(ms);Heuristic\n";
+
+    // Zeiten als Millisekunden mit Nachkommastellen (intern Nanosekunden)
+    auto ms = [](uint64_t ns) { return static_cast<double>(ns) / 1e6; };
 
     csv_file << stats.decisions << ";" << stats.conflicts << ";" << stats.propagations << ";"
             << stats.learnts_added << ";" << stats.clause_inspections << ";" << stats.watch_moves << ";"
-            << stats.t_bcp_ms << ";" << stats.t_analyze_ms << ";" << stats.restarts << ";"
+            << ms(stats.t_bcp_ns) << ";" << ms(stats.t_analyze_ns) << ";" << stats.restarts << ";"
             << (stats.learnt_lbd_count ? (double)stats.learnt_lbd_sum / (double)stats.learnt_lbd_count : 0.0) << ";"
             << stats.learnt_lbd_le2 << ";" << stats.learnt_lbd_3_4 << ";" << stats.learnt_lbd_ge5 << ";"
-            << stats.deleted_count << ";" << stats.deleted_lbd_sum << ";" << heuristicToString(currentHeuristic) << "\n";
+            << stats.deleted_count << ";" << stats.deleted_lbd_sum << ";"
+            << stats.subsumed_learnts << ";" << stats.strengthened_learnts << ";"
+            << stats.probe_failed << ";" << stats.probe_implied << ";" << stats.probe_hbr << ";"
+            << stats.probe_conflicts << ";"
+            << stats.els_substituted << ";"
+            << stats.vivify_checked << ";" << stats.vivify_shrunk << ";" << stats.vivify_lits << ";"
+            << stats.vivify_conflicts << ";"
+            << stats.xor_constraints << ";" << stats.xor_props << ";" << stats.xor_conflicts << ";"
+            << stats.amo_constraints << ";" << stats.amo_props << ";" << stats.amo_conflicts << ";"
+            << stats.ls_runs << ";" << stats.ls_flips << ";" << stats.ls_best_unsat << ";" << stats.ls_solved << ";"
+            << stats.shared_exported << ";" << stats.shared_imported << ";"
+            << stats.models_blocked << ";" << stats.proof_added << ";" << stats.proof_deleted << ";"
+            << ms(stats.t_parse_ns) << ";" << ms(stats.solveNs()) << ";" << ms(stats.t_search_ns) << ";"
+            << ms(stats.t_prepare_ns) << ";"
+            << ms(stats.t_decide_ns) << ";" << ms(stats.t_reduce_ns) << ";" << ms(stats.t_restart_ns) << ";"
+            << heuristicToString(currentHeuristic) << "\n";
 
 
     csv_file.close();
@@ -651,22 +898,40 @@ Clause* Solver::propagateLiteralFalse(const Literal &falsified) {
 // Neue (schnelle) Propagation via Two-Watched-Literals
 Clause *Solver::propagate() {
 
-    ScopedTimer _t(stats.t_bcp_ms); // Zeit für BCP messen
+    PROFILE_SCOPE(stats.t_bcp_ns); // Zeit für BCP messen
 
-    // Verarbeite alle neuen Trail-Einträge ab qhead
     const auto& tr = trail.getTrail();
-    while (qhead < tr.size()) {
-        Literal p = tr[qhead].lit; // nächstes unpropagiertes Literal
-        ++qhead;
+    while (true) {
+        // Verarbeite alle neuen Trail-Einträge ab qhead
+        while (qhead < tr.size()) {
+            Literal p = tr[qhead].lit; // nächstes unpropagiertes Literal
+            ++qhead;
+
+            // AMO-Constraints mit p: alle übrigen Literale werden falsch
+            if (!amoOcc[litToIndex(p)].empty()) {
+                if (Clause* confl = propagateAmo(p)) {
+                    stats.conflicts++;
+                    return confl;
+                }
+            }
 
-        // p == true → ¬p ist falsifiziert: nur diese Watch-Liste abarbeiten
-        Clause* confl = propagateLiteralFalse(negate(p));
+            // p == true → ¬p ist falsifiziert: nur diese Watch-Liste abarbeiten
+            Clause* confl = propagateLiteralFalse(negate(p));
+            if (confl) {
+                stats.conflicts++;
+                return confl;
+            }
+        }
+
+        // Klauseln am Fixpunkt → XOR-Matrix befragen (kann neue Einträge liefern)
+        if (!xorEngine.active()) return nullptr;
+        Clause* confl = propagateXor();
         if (confl) {
             stats.conflicts++;
             return confl;
         }
+        if (qhead == tr.size()) return nullptr;
     }
-    return nullptr;
 }
 
 // Alle Unit-Klauseln auf Level 0 in den Trail legen
@@ -685,18 +950,14 @@ void Solver::seedRootUnits() {
 
 // Klausel-Datenbank reduzieren (Glucose-Style Heuristik)
 void Solver::reduceDB() {
+    PROFILE_SCOPE(stats.t_reduce_ns);
     // --- Kandidaten sammeln: keine Units/Binaries, LBD>2, nicht locked ---
     struct Candidate { size_t idx; int lbd; size_t sz; double act; };
     std::vector<Candidate> cand;
     cand.reserve(clauses.size());
 
     // "locked" = dient aktuell als Reason auf dem Trail → behalten
-    auto isLocked = [&](size_t cidx) -> bool {
-        for (const auto& e : trail.getTrail()) {
-            if (e.reason_idx == static_cast<int>(cidx)) return true;
-        }
-        return false;
-    };
+    const std::vector<bool> locked = lockedClauses();
 
     // Auswahl der zu prüfenden gelernten Klauseln
     for (size_t i = 0; i < clauses.size(); ++i) {
@@ -706,7 +967,7 @@ void Solver::reduceDB() {
         if (sz <= 2) continue;              // Units/Binaries behalten
         const int lbd = c.getLBD();
         if (lbd <= 2) continue;             // sehr gute Klauseln behalten
-        if (isLocked(i)) continue;          // Reason-Klauseln behalten
+        if (locked[i]) continue;            // Reason-Klauseln behalten
         cand.push_back({i, lbd, sz, clauses[i].getActivity()});
     }
 
@@ -738,39 +999,860 @@ void Solver::reduceDB() {
         mark[cand[k].idx] = true;
     }
 
-    // Watches der Klausel abmelden
-    auto detachBothWatches = [&](size_t cidx) {
-        Clause& C = clauses[cidx];
-        int w0 = C.watch0();
-        int w1 = C.watch1();
-        if (w0 != -1) detachClause(cidx, C.at(w0));
-        if (w1 != -1) detachClause(cidx, C.at(w1));
+    // Klauseln entfernen (Watch-Listen + Trail-Reasons werden angepasst)
+    removeMarkedClauses(mark);
+
+    // Periodisch: neue gelernte Klauseln gegen die Datenbank subsumieren/verkürzen
+    if (reduce_count % subsume_interval == 0) subsumeLearnts();
+}
+
+// Klauseln ermitteln, die aktuell Reason einer Zuweisung sind
+std::vector<bool> Solver::lockedClauses() const {
+    std::vector<bool> locked(clauses.size(), false);
+    for (const auto& e : trail.getTrail()) {
+        if (e.reason_idx >= 0 && e.reason_idx < static_cast<int>(clauses.size())) locked[e.reason_idx] = true;
+    }
+    return locked;
+}
+
+// Markierte Klauseln entfernen: stabil kompaktieren, alte → neue Indizes abbilden
+// und damit die Reasons im Trail und die Einträge der Watch-Listen umschreiben
+// (entfernte Klauseln fallen heraus, die übrigen behalten ihre Watches)
+void Solver::removeMarkedClauses(const std::vector<bool>& mark) {
+    if (std::ranges::find(mark, true) == mark.end()) return;
+
+    std::vector<int> newIndex(clauses.size(), -1);
+    size_t j = 0;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        if (mark[i]) {
+            if (proof != nullptr) proofDelete(clauses[i].getClause());
+            continue;
+        }
+        newIndex[i] = static_cast<int>(j);
+        if (i != j) clauses[j] = std::move(clauses[i]);
+        ++j;
+    }
+    clauses.erase(clauses.begin() + static_cast<std::ptrdiff_t>(j), clauses.end());
+
+    trail.remapReasons(newIndex);
+    for (auto& wl : watchList) {
+        size_t k = 0;
+        for (size_t idx : wl) {
+            if (newIndex[idx] != -1) wl[k++] = static_cast<size_t>(newIndex[idx]);
+        }
+        wl.resize(k);
+    }
+}
+
+// Watch-Listen leeren und alle Klauseln gemäß ihrer Watch-Indizes neu einhängen
+void Solver::rebuildWatchLists() {
+    for (auto& wl : watchList) wl.clear();
+    attachExistingClauses();
+}
+
+// Subsumption auf gelernten Klauseln: nur seit dem letzten Lauf hinzugekommene oder
+// verkürzte, nicht gesperrte gelernte Klauseln dürfen entfernt oder verkürzt werden,
+// alle Klauseln dienen als Subsumierer
+void Solver::subsumeLearnts() {
+    const std::vector<bool> locked = lockedClauses();
+    std::vector<bool> candidate(clauses.size(), false);
+    bool any = false;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        candidate[i] = clauses[i].isLearnt() && !clauses[i].isSubsumeChecked() && !locked[i];
+        any = any || candidate[i];
+    }
+    if (!any) return;
+
+    const Subsumption subsumption{2'000'000};
+    Subsumption::Result res = subsumption.run(clauses, numVars, candidate);
+    // Nur nach vollständigem Lauf gelten die Kandidaten als geprüft; bei Abbruch am
+    // Schrittlimit wurden nicht alle Subsumierer getestet → im nächsten Lauf erneut
+    if (res.complete) {
+        for (size_t i = 0; i < clauses.size(); ++i) {
+            if (candidate[i]) clauses[i].setSubsumeChecked(true);
+        }
+    }
+    if (res.removedCount == 0 && res.strengthened.empty()) return;
+
+    auto isFalse = [&](const Literal& l) {
+        const int a = assignment[l.getVar()];
+        return a != -1 && ((a == 1) == l.isNegated());
     };
 
-    // Nach Erase: alle Watch-Listen-Indizes > removedIdx dekrementieren
-    auto adjustWatchListsAfterErase = [&](size_t removedIdx) {
-        for (auto& wl : watchList) {
-            for (auto& idx : wl) {
-                if (idx > removedIdx) --idx;
+    // Beweis: Strengthening-Schritte in Ableitungsreihenfolge nachspielen (ein verkürzter
+    // Subsumierer kann schon weitere Klauseln verkürzt haben); Zwischenstände wieder löschen
+    std::unordered_map<size_t, std::vector<Literal>> derived;
+    if (proof != nullptr) {
+        for (const auto& [idx, lit] : res.steps) {
+            auto it = derived.find(idx);
+            const std::vector<Literal>& prev = it != derived.end() ? it->second : clauses[idx].getClause();
+            std::vector<Literal> next;
+            for (const auto& l : prev) {
+                if (!(l == lit)) next.push_back(l);
             }
+            proofAdd(next);
+            if (it != derived.end()) proofDelete(prev);
+            derived[idx] = std::move(next);
+        }
+        for (const auto& [idx, lits] : derived) {
+            if (res.removed[idx]) proofDelete(lits);
+        }
+    }
+
+    // Verkürzte Klauseln übernehmen. Außerhalb von Level 0 nur, wenn zwei nicht-falsche
+    // Literale als Watches übrig bleiben (sonst bliebe eine Implikation unentdeckt)
+    for (auto& [idx, lits] : res.strengthened) {
+        std::vector<int> free;
+        for (size_t k = 0; k < lits.size() && free.size() < 2; ++k) {
+            if (!isFalse(lits[k])) free.push_back(static_cast<int>(k));
+        }
+        if (free.size() < 2) continue;
+
+        const Clause& old = clauses[idx];
+        stats.strengthened_learnts += old.size() - lits.size();
+        if (proof != nullptr) {
+            if (!derived.contains(idx)) proofAdd(lits); // nur Duplikate entfernt
+            proofDelete(old.getClause());
+        }
+        Clause c(std::move(lits));
+        c.setLearnt(true);
+        c.setLBD(std::min(old.getLBD(), static_cast<int>(c.size())));
+        c.bumpActivity(old.getActivity());
+        c.setWatch0(free[0]);
+        c.setWatch1(free[1]);
+        detachClauseWatches(idx);
+        clauses[idx] = std::move(c);
+        attachClause(idx, clauses[idx].at(clauses[idx].watch0()));
+        attachClause(idx, clauses[idx].at(clauses[idx].watch1()));
+    }
+
+    stats.subsumed_learnts += res.removedCount;
+    removeMarkedClauses(res.removed);
+}
+
+// Klausel auf Level 0 hinzufügen (nur aufrufen, wenn decisionLevel == 0)
+bool Solver::addRootClause(std::vector<Literal> lits, bool learnt, int lbd) {
+    std::vector<Literal> out;
+    out.reserve(lits.size());
+    for (const auto& l : lits) {
+        const int a = assignment[l.getVar()];
+        if (a != -1) {
+            if ((a == 1) != l.isNegated()) return true; // Literal wahr → Klausel erfüllt
+            continue;                                    // Literal falsch → streichen
+        }
+        if (std::ranges::find(out, negate(l)) != out.end()) return true; // Tautologie
+        if (std::ranges::find(out, l) == out.end()) out.push_back(l);
+    }
+    if (out.empty()) return false;
+
+    if (proof != nullptr) proofAdd(out);
+    Clause c(std::move(out));
+    c.setLearnt(learnt);
+    if (lbd >= 0) c.setLBD(std::min<int>(lbd, static_cast<int>(c.size())));
+    addClause(c);
+    if (c.size() == 1) {
+        assign(c.at(0), 0, static_cast<int>(clauses.size()) - 1);
+    }
+    return true;
+}
+
+// Ersetzte Variablen werden über ihren Repräsentanten angenommen
+Literal Solver::assumptionLiteral(const Literal& a) const {
+    const Literal r = substitutedBy[a.getVar()];
+    if (r.getVar() == 0) return a;
+    return a.isNegated() ? negate(r) : r;
+}
+
+// Vom falschen Literal ¬a rückwärts über den Trail: jede erreichte Entscheidung oberhalb
+// von Level 0 ist eine Annahme (dort gibt es nur Annahme-Ebenen)
+void Solver::analyzeFinal(const Literal& a) {
+    failedAssumptions.assign(1, a);
+    if (trail.getLevelOfVar(a.getVar()) == 0) return;
+
+    std::vector<uint8_t> seen(numVars + 1, 0);
+    seen[a.getVar()] = 1;
+    const auto& tr = trail.getTrail();
+    for (size_t i = tr.size(); i-- > 0;) {
+        const auto& e = tr[i];
+        const int v = e.lit.getVar();
+        if (!seen[v] || e.level == 0) continue;
+        if (e.reason_idx == -1) {
+            failedAssumptions.push_back(e.lit);
+            continue;
+        }
+        const Clause reason = e.reason_idx == Trail::LAZY_REASON ? explainLazyReason(v) : clauses[e.reason_idx];
+        for (const auto& l : reason.getClause()) {
+            if (trail.getLevelOfVar(l.getVar()) > 0) seen[l.getVar()] = 1;
+        }
+    }
+}
+
+// Blockklausel über den aktiven Variablen (Repräsentanten) der Projektion. Liegen alle
+// Entscheidungen in der Projektion, legen sie das Modell fest: dann genügt ihre Negation.
+// Literale werden nach Level absteigend sortiert, sodass die beiden Watches auf den
+// höchsten Leveln liegen; wie bei einer gelernten Klausel wird nur so weit zurückgesprungen,
+// dass die Klausel assertierend (ein Literal oben) oder frei (mehrere oben) wird
+bool Solver::blockModel(const std::vector<int>& projection) {
+    if (rootUnsat) return false;
+    stats.models_blocked++;
+
+    std::vector<uint8_t> inProj(numVars + 1, projection.empty() ? 1 : 0);
+    for (int v : projection) {
+        if (v >= 1 && v <= numVars) inProj[assumptionLiteral(Literal(v, false)).getVar()] = 1;
+    }
+
+    std::vector<int> levelOf(numVars + 1, 0);
+    bool decisionsInProj = true;
+    for (const auto& e : trail.getTrail()) {
+        levelOf[e.lit.getVar()] = e.level;
+        if (e.reason_idx == -1 && e.level > 0 && !inProj[e.lit.getVar()]) decisionsInProj = false;
+    }
+
+    std::vector<Literal> lits;
+    for (const auto& e : trail.getTrail()) {
+        const int v = e.lit.getVar();
+        if (e.level == 0 || !inProj[v] || eliminated[v]) continue;
+        if (decisionsInProj && e.reason_idx != -1) continue;
+        lits.push_back(negate(e.lit));
+    }
+    if (lits.empty()) {
+        rootUnsat = true;
+        return false;
+    }
+    std::ranges::stable_sort(lits, [&](const Literal& a, const Literal& b) {
+        return levelOf[a.getVar()] > levelOf[b.getVar()];
+    });
+
+    const int top    = levelOf[lits[0].getVar()];
+    const int second = lits.size() > 1 ? levelOf[lits[1].getVar()] : 0;
+    const bool asserting = second < top;
+    backtrackToLevel(asserting ? second : top - 1);
+
+    Clause c(std::move(lits));
+    addClause(c);
+    if (asserting) {
+        assign(c.at(0), second, static_cast<int>(clauses.size()) - 1);
+    }
+    resumeSearch = true;
+    return true;
+}
+
+bool Solver::isFailedAssumption(const Literal& a) const {
+    const Literal x = assumptionLiteral(a);
+    return std::ranges::any_of(failedAssumptions, [&](const Literal& f) {
+        return f.getVar() == x.getVar() && f.isNegated() == x.isNegated();
+    });
+}
+
+void Solver::reserveVars(int n) {
+    if (n <= numVars) return;
+    numVars = n;
+    assignment.resize(numVars + 1, -1);
+    savedPhase.resize(numVars + 1, -1);
+    eliminated.resize(numVars + 1, false);
+    substitutedBy.resize(numVars + 1, Literal(0, false));
+    frozen.resize(numVars + 1, false);
+    lazyKind.resize(numVars + 1, LazyKind::NONE);
+    watchList.resize(2 * numVars);
+    amoOcc.resize(2 * numVars);
+    if (!xorReason.empty()) xorReason.resize(numVars + 1);
+    if (!amoReason.empty()) amoReason.resize(numVars + 1, Literal(0, false));
+    heuristic.growVars(numVars);
+}
+
+// Vor dem ersten solve() nur sammeln (Watches baut prepare()), danach auf Level 0 einfügen
+bool Solver::addInputClause(std::vector<Literal> lits) {
+    if (rootUnsat) return false;
+    int maxVar = 0;
+    for (const auto& l : lits) maxVar = std::max(maxVar, l.getVar());
+    reserveVars(maxVar);
+
+    if (!prepared) {
+        std::vector<Literal> out;
+        out.reserve(lits.size());
+        for (const auto& l : lits) {
+            if (std::ranges::find(out, negate(l)) != out.end()) return true; // Tautologie
+            if (std::ranges::find(out, l) == out.end()) out.push_back(l);
         }
+        Clause c(std::move(out));
+        c.initWatchesDefault();
+        clauses.push_back(std::move(c));
+        return true;
+    }
+
+    backtrackToLevel(0);
+    for (auto& l : lits) l = assumptionLiteral(l);
+    if (!addRootClause(std::move(lits), false)) {
+        markRootUnsat();
+        return false;
+    }
+    return true;
+}
+
+void Solver::setClauseExchange(ClauseExchange* ex, size_t id) {
+    exchange   = ex;
+    exchangeId = id;
+}
+
+// Reihenfolge-unabhängiger Schlüssel einer Klausel (für die Duplikaterkennung)
+uint64_t Solver::sharedKey(std::vector<int32_t>& lits) const {
+    std::ranges::sort(lits);
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ lits.size();
+    for (int32_t l : lits) {
+        h ^= static_cast<uint64_t>(static_cast<uint32_t>(l)) + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+// Schlüssel in die Duplikat-Tabelle eintragen. Ein verdrängter Schlüssel wird höchstens
+// erneut geteilt bzw. übernommen (addRootClause verträgt Duplikate)
+bool Solver::markShared(uint64_t key) {
+    if (sharedSeen.empty()) sharedSeen.assign(kSharedSeenSlots, 0);
+    key |= 1; // 0 = freier Slot
+    uint64_t& slot = sharedSeen[(key >> 1) & (kSharedSeenSlots - 1)];
+    if (slot == key) return false;
+    slot = key;
+    return true;
+}
+
+// Gelernte Klausel veröffentlichen, falls kurz bzw. LBD klein genug
+void Solver::exportLearnt(const Clause& c) {
+    if (c.size() > share_max_size) return;
+    if (c.size() > 2 && c.getLBD() > share_max_lbd) return;
+
+    std::vector<int32_t> lits;
+    lits.reserve(c.size());
+    for (const auto& l : c.getClause()) lits.push_back(l.toInt());
+    if (!markShared(sharedKey(lits))) return; // schon geteilt oder übernommen
+
+    exchange->publish(exchangeId, lits.data(), lits.size(), c.getLBD());
+    stats.shared_exported++;
+}
+
+// Klauseln der anderen Worker übernehmen (nach dem Restart, Level 0). Gelernte Klauseln
+// folgen aus der gemeinsamen Eingabe und dürfen daher übernommen werden; Klauseln über
+// hier eliminierten Variablen werden verworfen
+bool Solver::importShared() {
+    sharedBuf.clear();
+    if (exchange->collect(exchangeId, sharedBuf) == 0) return true;
+
+    std::vector<int32_t> key;
+    std::vector<Literal> lits;
+    for (const auto& sc : sharedBuf) {
+        key.assign(sc.lits.begin(), sc.lits.begin() + sc.size);
+        const bool usable = std::ranges::all_of(key, [&](int32_t l) {
+            const int v = std::abs(l);
+            return v >= 1 && v <= numVars && !eliminated[v];
+        });
+        if (!usable || !markShared(sharedKey(key))) continue;
+
+        lits.clear();
+        for (int32_t l : key) lits.emplace_back(std::abs(l), l < 0);
+        if (!addRootClause(lits, true, sc.lbd)) return false;
+        stats.shared_imported++;
+    }
+    return true;
+}
+
+// Inprocessing an Restart-Punkten (Level 0)
+bool Solver::inprocess() {
+    if (stats.restarts % probe_interval == 0) {
+        if (propagate() != nullptr) return false;
+        if (!probe(probe_budget_restart)) return false;
+    }
+    if (stats.restarts % vivify_interval == 0) {
+        if (propagate() != nullptr) return false;
+        if (!vivifyLearnts(vivify_budget)) return false;
+    }
+    // Rephasing: lokale Suche ab den aktuellen (Trail-)Phasen
+    if (stats.conflicts >= ls_next_rephase) {
+        ls_next_rephase += ls_rephase_base * (++ls_rephase_count);
+        localSearchPhases(ls_flips_rephase, ls_flips_per_clause_rephase);
+    }
+    return true;
+}
+
+// Klausel aus den Watch-Listen ihrer beiden beobachteten Literale entfernen
+void Solver::detachClauseWatches(size_t clauseIdx) {
+    const Clause& C = clauses[clauseIdx];
+    for (int w : {C.watch0(), C.watch1()}) {
+        if (w == -1) continue;
+        auto& wl = watchList[litToIndex(C.at(w))];
+        std::erase(wl, clauseIdx);
+    }
+}
+
+// Vivifikation gelernter Klauseln:
+//  - Kandidaten: gelernte, nicht gesperrte, noch nicht vivifizierte Klauseln (> 2 Literale)
+//  - Reihenfolge: Tier (LBD <= 2, <= 6, Rest), dann LBD, dann Aktivität
+//  - für C = (l1 ∨ ... ∨ lk): ¬l1, ¬l2, ... nacheinander entscheiden und propagieren
+//      * Konflikt           → C' = {l1..li}
+//      * lj wird wahr       → C' = {l1..li, lj}
+//      * lj wird falsch     → lj streichen
+//  Die Klausel selbst ist währenddessen abgemeldet, damit sie sich nicht selbst bestätigt.
+bool Solver::vivifyLearnts(uint64_t budget) {
+    if (decisionLevel != 0) return true;
+    const ConflictRedirect redirect{stats.conflicts, stats.vivify_conflicts};
+
+    const std::vector<bool> locked = lockedClauses();
+    std::vector<size_t> cand;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        const Clause& c = clauses[i];
+        if (!c.isLearnt() || c.isVivified() || c.size() <= 2 || locked[i]) continue;
+        cand.push_back(i);
+    }
+    if (cand.empty()) return true;
+
+    auto tier = [](int lbd) { return lbd <= 2 ? 0 : (lbd <= 6 ? 1 : 2); };
+    std::sort(cand.begin(), cand.end(), [&](size_t a, size_t b) {
+        const Clause& A = clauses[a];
+        const Clause& B = clauses[b];
+        if (tier(A.getLBD()) != tier(B.getLBD())) return tier(A.getLBD()) < tier(B.getLBD());
+        if (A.getLBD() != B.getLBD()) return A.getLBD() < B.getLBD();
+        return A.getActivity() > B.getActivity();
+    });
+
+    const std::vector<int> phases = savedPhase;
+    const uint64_t startTicks = stats.clause_inspections;
+    std::vector<bool> mark(clauses.size(), false);
+    std::vector<Literal> units;
+
+    auto valueOf = [&](const Literal& l) {
+        const int a = assignment[l.getVar()];
+        return a == -1 ? -1 : ((a == 1) != l.isNegated() ? 1 : 0);
+    };
+
+    for (size_t idx : cand) {
+        if (stats.clause_inspections - startTicks > budget) break;
+        stats.vivify_checked++;
+
+        detachClauseWatches(idx);
+        const std::vector<Literal> lits = clauses[idx].getClause();
+        std::vector<Literal> kept;
+        bool satisfied = false;
+
+        for (const auto& l : lits) {
+            const int val = valueOf(l);
+            if (val == 1) {
+                // Auf Level 0 wahr → Klausel erfüllt, sonst von den bisherigen Negationen impliziert
+                if (trail.getLevelOfVar(l.getVar()) == 0) satisfied = true;
+                else kept.push_back(l);
+                break;
+            }
+            if (val == 0) continue; // falsch (auf Level 0 oder impliziert) → streichen
+
+            kept.push_back(l);
+            decisionLevel++;
+            assign(negate(l), decisionLevel, -1);
+            if (propagate() != nullptr) break; // Konflikt → bisherige Literale genügen
+        }
+        backtrackToLevel(0);
+
+        Clause& C = clauses[idx];
+        if (satisfied) {
+            mark[idx] = true;
+            continue;
+        }
+        if (kept.empty()) return false; // alle Literale auf Level 0 falsch
+
+        if (kept.size() < lits.size()) {
+            stats.vivify_shrunk++;
+            stats.vivify_lits += lits.size() - kept.size();
+            if (kept.size() == 1) {
+                // Unit → nach der Schleife auf Level 0 setzen
+                units.push_back(kept[0]);
+                mark[idx] = true;
+                continue;
+            }
+            Clause nc(std::move(kept));
+            nc.setLearnt(true);
+            nc.setLBD(std::min(C.getLBD(), static_cast<int>(nc.size())));
+            nc.bumpActivity(C.getActivity());
+            nc.initWatchesDefault();
+            if (proof != nullptr) {
+                proofAdd(nc.getClause());
+                proofDelete(C.getClause());
+            }
+            C = std::move(nc);
+        }
+        C.setVivified(true);
+
+        // Wieder anmelden (neue oder unveränderte Watches)
+        attachClause(idx, C.at(C.watch0()));
+        attachClause(idx, C.at(C.watch1()));
+    }
+
+    savedPhase = phases;
+    // Units vor dem Löschen ihrer Ursprungsklauseln eintragen: im Beweis ist u nur RUP,
+    // solange C noch vorhanden ist
+    for (const auto& u : units) {
+        if (!addRootClause({u}, true)) return false;
+    }
+    mark.resize(clauses.size(), false);
+    removeMarkedClauses(mark);
+    return propagate() == nullptr;
+}
+
+// Failed-Literal-Probing:
+//  - Kandidaten: Variablen, deren Literal eine Wurzel im binären Implikationsgraphen ist
+//    (l → x über (¬l ∨ x), aber keine binäre Klausel impliziert l)
+//  - l auf Level 1 setzen und propagieren: Konflikt → ¬l ist Unit
+//  - sonst: beide Polaritäten probieren, gemeinsame Implikationen sind Units
+//  - Implikationsbaum auf Level 1: jedes Literal hängt an seinem Dominator (bei binärer
+//    Reason das Antezedens, bei längerer Reason der tiefste gemeinsame Vorfahr aller
+//    Antezedenzien). Für x mit längerer Reason und Dominator d ist (¬d ∨ x) die
+//    Hyper-Binary-Resolvente (höchstens 64 je Kandidat)
+bool Solver::probe(uint64_t budget) {
+    if (decisionLevel != 0) return true;
+    const ConflictRedirect redirect{stats.conflicts, stats.probe_conflicts};
+
+    // Vorkommen jedes Literals in (noch nicht erfüllten) binären Klauseln zählen
+    std::vector<int> binOcc(2 * numVars, 0);
+    for (const auto& c : clauses) {
+        if (c.size() != 2) continue;
+        if (assignment[c.at(0).getVar()] != -1 || assignment[c.at(1).getVar()] != -1) continue;
+        ++binOcc[litToIndex(c.at(0))];
+        ++binOcc[litToIndex(c.at(1))];
+    }
+
+    // Wurzeln: ¬l kommt in binären Klauseln vor (l hat Nachfolger), l selbst nicht
+    std::vector<int> candidates;
+    for (int v = 1; v <= numVars; ++v) {
+        if (assignment[v] != -1) continue;
+        const int pos = binOcc[litToIndex(Literal(v, false))];
+        const int neg = binOcc[litToIndex(Literal(v, true))];
+        if ((pos > 0) != (neg > 0)) candidates.push_back(v);
+    }
+    if (candidates.empty()) return true;
+
+    // Probing verändert die gespeicherten Phasen nicht
+    const std::vector<int> phases = savedPhase;
+    const uint64_t startProps = stats.propagations;
+
+    std::vector<int> stamp(2 * numVars, 0); // Implikationen der ersten Polarität
+    int stampId = 0;
+    std::vector<Literal> implied;
+    std::vector<std::pair<Literal, Literal>> hbr; // (¬Dominator, x)
+
+    // Implikationsbaum über die Trail-Positionen der Level-1-Literale (Wurzel = Probe)
+    std::vector<int> posOf(numVars + 1, 0);
+    std::vector<int> posStamp(numVars + 1, 0);
+    int posId = 0;
+    std::vector<size_t> parent, depth;
+    std::vector<size_t> ante;
+
+    // Tiefster gemeinsamer Vorfahr zweier Baumknoten
+    auto lca = [&](size_t a, size_t b) {
+        while (a != b) {
+            if (depth[a] >= depth[b]) a = parent[a];
+            else b = parent[b];
+        }
+        return a;
     };
 
-    // Rückwärts löschen (stabile Indizes) + Watchlisten anpassen
-    size_t i = clauses.size();
-    while (i > 0) {
-        --i; // dekrementiere zuerst
-        if (!mark[i]) continue;
-        detachBothWatches(i);
-        clauses.erase(clauses.begin() + i);
-        adjustWatchListsAfterErase(i);
-        // Trail-Reason-Anpassungen nicht nötig: locked-Klauseln wurden ausgeschlossen
+    // Ein Literal auf Level 1 probieren. false = Konflikt (failed literal)
+    auto probeLiteral = [&](const Literal& l) -> bool {
+        implied.clear();
+        decisionLevel = 1;
+        const size_t root = trail.getTrail().size();
+        assign(l, 1, -1);
+        const bool conflict = (propagate() != nullptr);
+        if (!conflict) {
+            const auto& tr = trail.getTrail();
+            ++posId;
+            parent.assign(tr.size(), root);
+            depth.assign(tr.size(), 0);
+            posStamp[l.getVar()] = posId;
+            posOf[l.getVar()] = static_cast<int>(root);
+            for (size_t i = root + 1; i < tr.size(); ++i) {
+                const auto& e = tr[i];
+                posStamp[e.lit.getVar()] = posId;
+                posOf[e.lit.getVar()] = static_cast<int>(i);
+                implied.push_back(e.lit);
+
+                // Lazy Reasons (XOR/AMO) hängen direkt an der Wurzel
+                if (e.reason_idx < 0) {
+                    depth[i] = 1;
+                    continue;
+                }
+                const Clause& reason = clauses[e.reason_idx];
+                ante.clear();
+                for (const auto& r : reason.getClause()) {
+                    const int v = r.getVar();
+                    if (v != e.lit.getVar() && posStamp[v] == posId) ante.push_back(static_cast<size_t>(posOf[v]));
+                }
+                size_t dom = root;
+                if (!ante.empty()) {
+                    dom = ante[0];
+                    for (size_t k = 1; k < ante.size(); ++k) dom = lca(dom, ante[k]);
+                }
+                parent[i] = dom;
+                depth[i] = depth[dom] + 1;
+
+                // Mehrere Antezedenzien auf Level 1: die Reason ist über d überbrückbar
+                if (ante.size() > 1 && hbr.size() < 64) {
+                    hbr.emplace_back(negate(tr[dom].lit), e.lit);
+                }
+            }
+        }
+        backtrackToLevel(0);
+        return !conflict;
+    };
+
+    for (int v : candidates) {
+        if (stats.propagations - startProps > budget) break;
+        if (assignment[v] != -1) continue;
+
+        const Literal pos(v, false);
+        const Literal neg(v, true);
+
+        // Erste Polarität
+        hbr.clear();
+        if (!probeLiteral(pos)) {
+            stats.probe_failed++;
+            if (!addRootClause({neg}, true) || propagate() != nullptr) return false;
+            continue;
+        }
+        ++stampId;
+        for (const auto& x : implied) stamp[litToIndex(x)] = stampId;
+
+        // Zweite Polarität
+        if (!probeLiteral(neg)) {
+            stats.probe_failed++;
+            if (!addRootClause({pos}, true) || propagate() != nullptr) return false;
+            continue;
+        }
+
+        // Hyper-Binary-Resolventen beider Polaritäten hinzufügen
+        for (const auto& [a, b] : hbr) {
+            if (!addRootClause({a, b}, true)) return false;
+            stats.probe_hbr++;
+        }
+
+        // Literale, die aus v und ¬v folgen, gelten auf Level 0
+        // (im Beweis über die beiden Binärklauseln (¬v ∨ x) und (v ∨ x))
+        for (const auto& x : implied) {
+            if (stamp[litToIndex(x)] != stampId) continue;
+            stats.probe_implied++;
+            if (proof != nullptr) {
+                proofAdd({neg, x});
+                proofAdd({pos, x});
+            }
+            if (!addRootClause({x}, true)) return false;
+            if (proof != nullptr) {
+                proofDelete({neg, x});
+                proofDelete({pos, x});
+            }
+        }
+        if (propagate() != nullptr) return false;
+    }
+
+    savedPhase = phases;
+    return true;
+}
+
+// Externen Rekonstruktionsstapel (z. B. aus BCE) übernehmen. Er wird beim Erweitern
+// des Modells nach den eigenen Einträgen des Solvers abgearbeitet.
+void Solver::addReconstruction(const Reconstruction& rec) {
+    reconstruction.append(rec);
+}
+
+// Äquivalenz-Substitution:
+//  1) binärer Implikationsgraph über unbelegte Literale: (a ∨ b) ergibt ¬a → b und ¬b → a
+//  2) starke Zusammenhangskomponenten (Tarjan, iterativ) = Äquivalenzklassen
+//  3) jede Klasse durch ihr Literal mit kleinster Variable ersetzen
+//  4) x ≡ r als zwei Klauseln für die Modell-Rekonstruktion vormerken
+bool Solver::substituteEquivalences() {
+    if (decisionLevel != 0) return true;
+    const int N = 2 * numVars;
+
+    // --- Graph in CSR-Form (Knoten = litToIndex) ---
+    std::vector<int> start(N + 1, 0);
+    auto usable = [&](const Clause& c) {
+        return c.size() == 2
+            && assignment[c.at(0).getVar()] == -1 && assignment[c.at(1).getVar()] == -1
+            && c.at(0).getVar() != c.at(1).getVar();
+    };
+    for (const auto& c : clauses) {
+        if (!usable(c)) continue;
+        ++start[litToIndex(negate(c.at(0))) + 1];
+        ++start[litToIndex(negate(c.at(1))) + 1];
+    }
+    for (int i = 0; i < N; ++i) start[i + 1] += start[i];
+    if (start[N] == 0) return true;
+
+    std::vector<int> adj(start[N]);
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for (const auto& c : clauses) {
+        if (!usable(c)) continue;
+        adj[fill[litToIndex(negate(c.at(0)))]++] = litToIndex(c.at(1));
+        adj[fill[litToIndex(negate(c.at(1)))]++] = litToIndex(c.at(0));
+    }
+
+    // --- Tarjan (iterativ mit explizitem Aufrufstapel) ---
+    std::vector<int> index(N, -1), low(N, 0), comp(N, -1);
+    std::vector<bool> onStack(N, false);
+    std::vector<int> sccStack;
+    std::vector<std::pair<int, int>> callStack; // (Knoten, nächste Kante)
+    int counter = 0, numComps = 0;
+
+    for (int root = 0; root < N; ++root) {
+        if (index[root] != -1 || start[root] == start[root + 1]) continue;
+        index[root] = low[root] = counter++;
+        sccStack.push_back(root);
+        onStack[root] = true;
+        callStack.emplace_back(root, start[root]);
+
+        while (!callStack.empty()) {
+            const int v = callStack.back().first;
+            const int e = callStack.back().second;
+            if (e < start[v + 1]) {
+                callStack.back().second = e + 1;
+                const int w = adj[e];
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    sccStack.push_back(w);
+                    onStack[w] = true;
+                    callStack.emplace_back(w, start[w]);
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+
+            // Alle Kanten von v bearbeitet: ggf. Komponente abschließen
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = sccStack.back();
+                    sccStack.pop_back();
+                    onStack[w] = false;
+                    comp[w] = numComps;
+                } while (w != v);
+                ++numComps;
+            }
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                const int parent = callStack.back().first;
+                low[parent] = std::min(low[parent], low[v]);
+            }
+        }
+    }
+
+    // --- Repräsentanten bestimmen (eingefrorene Variable, sonst kleinste Variable) ---
+    // Komponenten mit mehr als einer eingefrorenen Variable bleiben unangetastet
+    auto isFrozen = [&](int node) { return static_cast<bool>(frozen[node / 2 + 1]); };
+    auto nodeToLit = [](int node) { return Literal(node / 2 + 1, (node & 1) != 0); };
+    std::vector<int> rep(numComps, -1);
+    std::vector<int> frozenCount(numComps, 0);
+    for (int node = 0; node < N; ++node) {
+        if (comp[node] == -1) continue;
+        if (comp[node] == comp[node ^ 1]) { // l ≡ ¬l → UNSAT
+            if (proof != nullptr) {
+                proofAdd({negate(nodeToLit(node))}); // l → ¬l über die Implikationskette
+                proofAdd({nodeToLit(node)});
+            }
+            return false;
+        }
+        if (isFrozen(node)) ++frozenCount[comp[node]];
+        int& r = rep[comp[node]];
+        if (r == -1 || (isFrozen(node) && !isFrozen(r)) || (isFrozen(node) == isFrozen(r) && node < r)) r = node;
+    }
+
+    std::vector<int> repr(N);
+    bool any = false;
+    for (int node = 0; node < N; ++node) {
+        repr[node] = (comp[node] == -1 || frozenCount[comp[node]] > 1) ? node : rep[comp[node]];
+        if (repr[node] != node) any = true;
+    }
+    if (!any) return true;
+
+    // --- Ersetzte Variablen eliminieren und für die Rekonstruktion vormerken ---
+    for (int v = 1; v <= numVars; ++v) {
+        const int node = litToIndex(Literal(v, false));
+        if (repr[node] == node) continue;
+        const Literal x(v, false);
+        const Literal r = nodeToLit(repr[node]);
+        reconstruction.push(x, {x, negate(r)});          // r → x
+        reconstruction.push(negate(x), {negate(x), r});  // ¬r → ¬x
+        eliminated[v] = true;
+        substitutedBy[v] = r;
+        heuristic.eliminateVar(v);
+        stats.els_substituted++;
+    }
+
+    // --- Klauseln mit ersetzten Literalen neu aufbauen ---
+    std::vector<bool> mark(clauses.size(), false);
+    std::vector<std::pair<std::vector<Literal>, bool>> rebuilt; // (Literale, gelernt)
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        const auto& lits = clauses[i].getClause();
+        bool changed = false;
+        for (const auto& l : lits) {
+            if (repr[litToIndex(l)] != litToIndex(l)) { changed = true; break; }
+        }
+        if (!changed) continue;
+
+        std::vector<Literal> out;
+        out.reserve(lits.size());
+        for (const auto& l : lits) out.push_back(nodeToLit(repr[litToIndex(l)]));
+        mark[i] = true;
+        rebuilt.emplace_back(std::move(out), clauses[i].isLearnt());
+    }
+
+    // Im Beweis die ersetzten Klauseln vor dem Löschen der alten eintragen (RUP über die
+    // Äquivalenzketten); Duplikate und Tautologien entfallen
+    if (proof != nullptr) {
+        for (const auto& [lits, learnt] : rebuilt) {
+            std::vector<Literal> out;
+            bool tautology = false;
+            for (const auto& l : lits) {
+                if (std::ranges::find(out, negate(l)) != out.end()) tautology = true;
+                if (std::ranges::find(out, l) == out.end()) out.push_back(l);
+            }
+            if (!tautology) proofAdd(out);
+        }
+    }
+    removeMarkedClauses(mark);
+
+    // addRootClause entfernt Duplikate/Tautologien und setzt entstehende Units
+    for (auto& [lits, learnt] : rebuilt) {
+        if (!addRootClause(std::move(lits), learnt)) return false;
     }
+    return propagate() == nullptr;
+}
+
+void Solver::proofAdd(const std::vector<Literal>& lits) {
+    proof->add(lits);
+    stats.proof_added++;
+}
+
+void Solver::proofDelete(const std::vector<Literal>& lits) {
+    proof->remove(lits);
+    stats.proof_deleted++;
+}
+
+void Solver::markRootUnsat() {
+    if (!rootUnsat && proof != nullptr) proofAdd({});
+    rootUnsat = true;
 }
 
 // Seed für Random-Heuristik weiterreichen
 void Solver::setHeuristicSeed(uint64_t s) {
     heuristic.setSeed(s);
+    ls_seed = s;
+}
+
+void Solver::setRestartPolicy(RestartPolicy policy) {
+    restartPolicy = policy;
+    restart_budget = restartBudget();
+}
+
+int Solver::restartBudget() const {
+    if (restartPolicy == RestartPolicy::GEOMETRIC) {
+        const double b = restart_geo_first * std::pow(restart_geo_factor, restart_idx - 1);
+        return b >= 1e9 ? 1'000'000'000 : static_cast<int>(b);
+    }
+    return restart_base * luby(restart_idx);
 }
 
 // Aktivität einer Klausel erhöhen + Rescale-Schutz
@@ -787,4 +1869,182 @@ void Solver::bumpClauseActivity(Clause &c) {
 // Zerfall des Klausel-Inkrements (wie bei VSIDS varInc)
 void Solver::decayClauseInc() {
     clauseInc /= clauseDecay;
-}
\ No newline at end of file
+}
+// XORs erkennen und Matrix aufbauen. Sehr große Systeme werden nicht eliminiert
+// (Zeilen × Spalten dicht gespeichert, Elimination quadratisch in der Zeilenzahl).
+void Solver::initGauss() {
+    if (decisionLevel != 0) return;
+    const auto xors = XorEngine::detect(clauses);
+    if (xors.empty() || xors.size() > gauss_max_rows) return;
+
+    xorEngine.init(xors, numVars);
+    xorReason.assign(numVars + 1, {});
+    xorHead = 0; // bestehende Level-0-Belegung wird beim nächsten propagate() übernommen
+    stats.xor_constraints = xors.size();
+}
+
+// Gauß-Propagation (nach dem Klausel-Fixpunkt)
+Clause* Solver::propagateXor() {
+    const auto& tr = trail.getTrail();
+    for (; xorHead < tr.size(); ++xorHead) {
+        const Literal& l = tr[xorHead].lit;
+        xorEngine.assign(l.getVar(), !l.isNegated());
+    }
+
+    xorImplied.clear();
+    const int conflictRow = xorEngine.propagate(xorImplied);
+    if (conflictRow != -1) {
+        stats.xor_conflicts++;
+        lazyConflict = Clause(xorEngine.explain(xorEngine.row(conflictRow), 0, assignment));
+        return &lazyConflict;
+    }
+
+    for (const auto& imp : xorImplied) {
+        // Bereits belegt (z. B. durch eine frühere Implikation dieser Runde): ein
+        // Widerspruch fällt bei der nächsten Übernahme in die Matrix auf
+        if (assignment[imp.var] != -1) continue;
+        xorReason[imp.var] = xorEngine.row(imp.row); // Zeilenkopie, Klausel erst bei Bedarf
+        lazyKind[imp.var]  = LazyKind::XOR;
+        stats.xor_props++;
+        assign(Literal(imp.var, !imp.value), trail.currentLevel(), Trail::LAZY_REASON);
+    }
+    return nullptr;
+}
+
+// AMO-Propagation für das wahre Literal p
+Clause* Solver::propagateAmo(const Literal& p) {
+    for (int id : amoOcc[litToIndex(p)]) {
+        // Schon ein anderes Literal wahr → Konflikt (¬q ∨ ¬p)
+        if (amoTrue[id].getVar() != 0) {
+            stats.amo_conflicts++;
+            lazyConflict = Clause({negate(amoTrue[id]), negate(p)});
+            return &lazyConflict;
+        }
+        amoTrue[id] = p;
+
+        for (const auto& o : amos[id]) {
+            if (o == p) continue;
+            const int a = assignment[o.getVar()];
+            if (a == -1) {
+                // Reason (¬o ∨ ¬p) erst bei Bedarf erzeugen
+                amoReason[o.getVar()] = p;
+                lazyKind[o.getVar()]  = LazyKind::AMO;
+                stats.amo_props++;
+                assign(negate(o), trail.currentLevel(), Trail::LAZY_REASON);
+            } else if ((a == 1) != o.isNegated()) {
+                // o ist wahr, aber noch nicht verarbeitet
+                stats.amo_conflicts++;
+                lazyConflict = Clause({negate(o), negate(p)});
+                return &lazyConflict;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void Solver::addAtMostOne(const std::vector<Literal>& lits) {
+    const int id = static_cast<int>(amos.size());
+    amos.push_back(lits);
+    amoTrue.emplace_back(0, false);
+    for (const auto& l : lits) {
+        amoOcc[litToIndex(l)].push_back(id);
+        freezeVariable(l.getVar());
+    }
+    if (amoReason.empty()) amoReason.assign(numVars + 1, Literal(0, false));
+    stats.amo_constraints++;
+}
+
+void Solver::freezeVariable(int var) {
+    frozen[var] = true;
+}
+
+void Solver::setStopFlag(const std::atomic<bool>* flag) {
+    stopFlag = flag;
+}
+
+// Lokale Suche auf der Level-0-reduzierten Formel: erfüllte Klauseln entfallen, falsche
+// Literale werden gestrichen, AMO-Constraints als paarweise Binärklauseln übernommen.
+// Gelernte Klauseln bleiben außen vor (sie folgen aus den Originalklauseln).
+void Solver::localSearchPhases(uint64_t maxFlips, uint64_t flipsPerClause) {
+    if (decisionLevel != 0 || maxFlips == 0) return;
+
+    auto litValue = [&](const Literal& l) {
+        const int a = assignment[l.getVar()];
+        return a == -1 ? -1 : ((a == 1) != l.isNegated() ? 1 : 0);
+    };
+
+    LocalSearch ls(numVars, ls_seed + stats.ls_runs);
+    std::vector<Literal> lits;
+    for (const auto& c : clauses) {
+        if (c.isLearnt()) continue;
+        lits.clear();
+        bool sat = false;
+        for (const auto& l : c.getClause()) {
+            const int v = litValue(l);
+            if (v == 1) { sat = true; break; }
+            if (v == -1 && std::ranges::find(lits, l) == lits.end()) lits.push_back(l);
+        }
+        if (!sat && !lits.empty()) ls.addClause(lits);
+    }
+    for (const auto& amo : amos) {
+        std::vector<Literal> open;
+        for (const auto& l : amo) {
+            if (litValue(l) == -1) open.push_back(l);
+        }
+        if (open.size() > ls_amo_max_size) continue;
+        for (size_t i = 0; i < open.size(); ++i) {
+            for (size_t j = i + 1; j < open.size(); ++j) ls.addClause({negate(open[i]), negate(open[j])});
+        }
+    }
+    if (ls.numClauses() == 0) return;
+
+    std::vector<int> phases = savedPhase;
+    for (int v = 1; v <= numVars; ++v) {
+        if (assignment[v] != -1) phases[v] = assignment[v];
+    }
+    const auto res = ls.run(phases, std::min<uint64_t>(maxFlips, flipsPerClause * ls.numClauses()));
+
+    for (int v = 1; v <= numVars; ++v) {
+        if (assignment[v] == -1 && !eliminated[v] && phases[v] != -1) savedPhase[v] = phases[v];
+    }
+    stats.ls_runs++;
+    stats.ls_flips += res.flips;
+    stats.ls_best_unsat = res.bestUnsat;
+    if (res.bestUnsat == 0) {
+        stats.ls_solved++;
+        lsModel = phases;
+    }
+}
+
+// ProbSAT kennt weder gelernte Klauseln noch AMOs über ls_amo_max_size noch später
+// hinzugefügte Klauseln: die Propagation über die vollständige Belegung prüft alle
+// Constraints (Klauseln, AMO, Gauß). Bei Konflikt oder widersprechender Belegung
+// (z. B. Annahmen) geht die Suche normal weiter.
+bool Solver::installLocalSearchModel() {
+    std::vector<int> model = std::move(lsModel);
+    lsModel.clear();
+    model.resize(numVars + 1, -1); // Variablen, die nach der lokalen Suche hinzukamen
+    for (int v = 1; v <= numVars; ++v) {
+        if (assignment[v] != -1 && !eliminated[v] && model[v] != -1 && assignment[v] != model[v]) return false;
+    }
+
+    const int level = decisionLevel;
+    decisionLevel++;
+    for (int v = 1; v <= numVars; ++v) {
+        if (assignment[v] == -1 && !eliminated[v]) assign(Literal(v, model[v] != 1), decisionLevel, -1);
+    }
+    if (propagate() != nullptr) {
+        backtrackToLevel(level);
+        return false;
+    }
+    return allVariablesAssigned();
+}
+
+// Reason-Klausel aus gesicherter XOR-Zeile bzw. auslösendem AMO-Literal erzeugen
+Clause Solver::explainLazyReason(int var) const {
+    if (lazyKind[var] == LazyKind::AMO) {
+        const Literal implied(var, assignment[var] == 0);
+        return Clause({implied, negate(amoReason[var])});
+    }
+    return Clause(xorEngine.explain(xorReason[var], var, assignment));
+}
@@ -1,10 +1,15 @@
 #ifndef SOLVER_H
 #define SOLVER_H
 
+#include <atomic>
 #include <vector>
 #include "Clause.h"
+#include "ClauseExchange.h"
+#include "ProofWriter.h"
 #include "Trail.h"
 #include "Heuristic.h"
+#include "Reconstruction.h"
+#include "XorEngine.h"
 
 
 struct Stats {
@@ -12,7 +17,22 @@ struct Stats {
     uint64_t decisions=0, conflicts=0, propagations=0;  // Entscheidungen, Konflikte, Propagationseinträge
     uint64_t learnts_added=0, restarts=0;               // #gelernter Klauseln, #Restarts
     uint64_t clause_inspections=0, watch_moves=0;       // #besuchte Klauseln, #Watch-Verschiebungen
-    uint64_t t_bcp_ms=0, t_analyze_ms=0;                // Zeiten (ms) für BCP und Analyse
+
+    // Laufzeitprofil in Nanosekunden (nur mit GUMS_PROFILE, siehe Timer.h). Jede Phase zählt
+    // nur ihre eigene Zeit (BCP während Probing/Vivifikation zählt als BCP, nicht als Restart),
+    // die Summe aller Phasen außer dem Einlesen ist die Zeit in solve()
+    uint64_t t_parse_ns   = 0;  // Einlesen der Formel (von main gesetzt)
+    uint64_t t_search_ns  = 0;  // übrige Zeit in solve() (Suchschleife, Backjumps, Annahmen)
+    uint64_t t_prepare_ns = 0;  // einmalige Vorverarbeitung (Probing, Substitution, Gauß, lokale Suche)
+    uint64_t t_bcp_ns     = 0;  // Unit-Propagation
+    uint64_t t_analyze_ns = 0;  // Konfliktanalyse
+    uint64_t t_decide_ns  = 0;  // Entscheidungen der aktiven Heuristik
+    uint64_t t_reduce_ns  = 0;  // reduceDB (inkl. Subsumption gelernter Klauseln)
+    uint64_t t_restart_ns = 0;  // Restarts (Klauselimport + Inprocessing)
+
+    uint64_t solveNs() const {
+        return t_search_ns + t_prepare_ns + t_bcp_ns + t_analyze_ns + t_decide_ns + t_reduce_ns + t_restart_ns;
+    }
 
     // LBD-Statistiken (Qualität gelernter Klauseln)
     uint64_t learnt_lbd_sum   = 0;  // Summe der LBDs gelernter Klauseln
@@ -24,6 +44,56 @@ struct Stats {
     // Deletion-Statistiken
     uint64_t deleted_count    = 0;  // #gelöschter Klauseln in reduceDB
     uint64_t deleted_lbd_sum  = 0;  // Summe der LBDs gelöschter Klauseln
+
+    // Subsumption-Statistiken (gelernte Klauseln, periodisch in reduceDB)
+    uint64_t subsumed_learnts     = 0;  // #durch andere Klauseln subsumierter gelernter Klauseln
+    uint64_t strengthened_learnts = 0;  // #durch Self-Subsuming Resolution entfernter Literale
+
+    // Probing-Statistiken (Failed Literals, Level 0)
+    uint64_t probe_failed    = 0;  // #Failed Literals (Negation als Unit gelernt)
+    uint64_t probe_implied   = 0;  // #Units, die aus beiden Polaritäten folgen
+    uint64_t probe_hbr       = 0;  // #Hyper-Binary-Resolventen
+    uint64_t probe_conflicts = 0;  // #Konflikte beim Probing (nicht in 'conflicts' enthalten)
+
+    // Äquivalenz-Substitution (SCC im binären Implikationsgraphen)
+    uint64_t els_substituted = 0;  // #durch ihren Repräsentanten ersetzter Variablen
+
+    // Vivifikation gelernter Klauseln (an Restarts)
+    uint64_t vivify_checked   = 0;  // #geprüfter Klauseln
+    uint64_t vivify_shrunk    = 0;  // #verkürzter Klauseln
+    uint64_t vivify_lits      = 0;  // #entfernter Literale
+    uint64_t vivify_conflicts = 0;  // #Konflikte bei der Vivifikation (nicht in 'conflicts' enthalten)
+
+    // Gauß-Elimination über erkannten XOR-Constraints
+    uint64_t xor_constraints = 0;  // #erkannter XORs
+    uint64_t xor_props       = 0;  // #Implikationen aus der Matrix
+    uint64_t xor_conflicts   = 0;  // #Konflikte aus der Matrix
+
+    // At-Most-One-Constraints (native Propagation statt paarweiser Binärklauseln)
+    uint64_t amo_constraints = 0;  // #AMO-Constraints
+    uint64_t amo_props       = 0;  // #Implikationen (Literal falsch, da ein anderes wahr ist)
+    uint64_t amo_conflicts   = 0;  // #Konflikte (zwei Literale wahr)
+
+    // Lokale Suche (ProbSAT) für Phasen-Initialisierung/Rephasing
+    uint64_t ls_runs       = 0;  // #Läufe
+    uint64_t ls_flips      = 0;  // #Flips insgesamt
+    uint64_t ls_best_unsat = 0;  // #unerfüllter Klauseln der besten Belegung (letzter Lauf)
+    uint64_t ls_solved     = 0;  // #Läufe, die alle Klauseln erfüllt haben
+
+    // Klauseltausch zwischen parallelen Workern
+    uint64_t shared_exported = 0;  // #veröffentlichter gelernter Klauseln
+    uint64_t shared_imported = 0;  // #übernommener Klauseln anderer Worker
+
+    // Modellaufzählung
+    uint64_t models_blocked = 0;   // #durch Blockklauseln ausgeschlossener Modelle
+
+    // DRAT-Beweis
+    uint64_t proof_added   = 0;  // #geschriebener Lemmata (inkl. leerer Klausel)
+    uint64_t proof_deleted = 0;  // #geschriebener Löschungen
+
+    // Zählwerte und Phasenzeiten eines anderen Laufs aufaddieren (Komponenten-Modus);
+    // die Einlesezeit bleibt unverändert, da sie allen Läufen gemeinsam ist
+    Stats& operator+=(const Stats& o);
 };
 
 // verfügbare Variablenwahl-Heuristiken
@@ -33,6 +103,12 @@ enum class HeuristicType {
     VSIDS,          // (E)VSIDS: Aktivitäten + Heap
 };
 
+// Restart-Strategien (Konfliktbudget zwischen zwei Restarts)
+enum class RestartPolicy {
+    LUBY,       // restart_base * luby(i)
+    GEOMETRIC,  // restart_geo_first * restart_geo_factor^(i-1)
+};
+
 class Solver {
 private:
 
@@ -55,6 +131,72 @@ private:
     // Propagation (Two-Watched-Literals): bearbeite die Watch-Liste des falsifizierten Literals
     Clause* propagateLiteralFalse(const Literal& falsified);
 
+    // Klauseln, die aktuell als Reason auf dem Trail stehen ("locked")
+    std::vector<bool> lockedClauses() const;
+
+    // Markierte Klauseln entfernen, Datenbank kompaktieren, Reasons + Watch-Listen anpassen
+    void removeMarkedClauses(const std::vector<bool>& mark);
+
+    // Alle Watch-Listen aus den Watch-Indizes der Klauseln neu aufbauen
+    void rebuildWatchLists();
+
+    // Subsumption/Self-Subsuming Resolution auf den gelernten Klauseln (aus reduceDB)
+    void subsumeLearnts();
+
+    // Klausel auf Level 0 hinzufügen: erfüllte verwerfen, falsche Literale streichen,
+    // Units direkt zuweisen (lbd >= 0: LBD vorgeben). false = leere Klausel (Formel UNSAT)
+    bool addRootClause(std::vector<Literal> lits, bool learnt, int lbd = -1);
+
+    // Inprocessing nach einem Restart (Level 0). false = Formel UNSAT
+    bool inprocess();
+
+    // Klauseltausch: kurze/gute gelernte Klauseln veröffentlichen bzw. an Restarts die
+    // Klauseln der anderen Worker übernehmen (Level 0). false = Formel UNSAT
+    void exportLearnt(const Clause& c);
+    bool importShared();
+    uint64_t sharedKey(std::vector<int32_t>& lits) const; // sortiert lits, Hash als Duplikat-Schlüssel
+    bool markShared(uint64_t key);                        // false = Schlüssel schon gesehen
+
+    // Failed-Literal-Probing mit Hyper-Binary-Resolution auf Level 0.
+    // budget = maximale Anzahl Propagationen. false = Formel UNSAT
+    bool probe(uint64_t budget);
+
+    // Äquivalente Literale (SCCs im binären Implikationsgraphen, Tarjan iterativ) durch
+    // ihren Repräsentanten ersetzen. Ersetzte Variablen gelten danach als eliminiert.
+    // false = Formel UNSAT (l und ¬l in derselben SCC)
+    bool substituteEquivalences();
+
+    // Gelernte Klauseln vivifizieren (Priorität: Tier, dann LBD): Negationen der Literale
+    // auf neuen Entscheidungsebenen setzen und propagieren; Konflikt oder implizierte
+    // Literale verkürzen die Klausel. budget = maximale Klausel-Inspektionen.
+    // false = Formel UNSAT
+    bool vivifyLearnts(uint64_t budget);
+
+    // Klausel aus beiden Watch-Listen lösen (alle Vorkommen)
+    void detachClauseWatches(size_t clauseIdx);
+
+    // XORs in den Originalklauseln erkennen und die Gauß-Matrix aufbauen (Level 0)
+    void initGauss();
+
+    // Neue Trail-Einträge in die Matrix übernehmen, Implikationen setzen.
+    // Rückgabe: Konfliktklausel (aus der Matrix erzeugt) oder nullptr
+    Clause* propagateXor();
+
+    // Wahres Literal p in allen AMO-Constraints verarbeiten: übrige Literale falsch setzen.
+    // Rückgabe: Konfliktklausel (¬p ∨ ¬q) oder nullptr
+    Clause* propagateAmo(const Literal& p);
+
+    // ProbSAT auf den Originalklauseln (Level 0, AMOs paarweise), Start bei savedPhase;
+    // die beste gefundene Belegung wird als neue Phase übernommen.
+    // Budget: min(maxFlips, flipsPerClause * #Klauseln)
+    void localSearchPhases(uint64_t maxFlips, uint64_t flipsPerClause);
+    // Erfüllende Belegung der lokalen Suche als eine Entscheidungsebene übernehmen;
+    // true = alle Constraints erfüllt (SAT), sonst wird die Ebene verworfen
+    bool installLocalSearchModel();
+
+    // Reason-Klausel einer Variable mit LAZY_REASON erzeugen
+    Clause explainLazyReason(int var) const;
+
     // Kern-Datenstrukturen
     std::vector<Clause> clauses;  // alle (auch gelernte) Klauseln
     Trail               trail;    // Zuweisungsverlauf (Literal, Level, Reason)
@@ -68,22 +210,137 @@ private:
     // Phase Saving: -1 = unbekannt, 0 = prefer false (negated), 1 = prefer true (non-negated)
     std::vector<int> savedPhase;
 
-    // Restart (Luby-Folge)
-    int restart_idx = 1;                 // Index in der Luby-Folge
-    int restart_base = 2;                // Basis-Multiplikator
+    // Eliminierte Variablen (kommen in keiner Klausel mehr vor, werden nicht entschieden)
+    std::vector<bool> eliminated;
+
+    // Äquivalenz-Substitution: x ≡ substitutedBy[x] (Variable 0 = nicht ersetzt)
+    std::vector<Literal> substitutedBy;
+
+    // Entfernte Klauseln/Äquivalenzen für die Modell-Rekonstruktion
+    Reconstruction reconstruction;
+
+    // Variablen, die nicht eliminiert/substituiert werden dürfen (z. B. in AMO-Constraints)
+    std::vector<bool> frozen;
+
+    // Herkunft eines lazy Reasons (Trail::LAZY_REASON) je Variable
+    enum class LazyKind : uint8_t { NONE, XOR, AMO };
+    std::vector<LazyKind> lazyKind;
+    Clause lazyConflict;                                // zuletzt erzeugte Konfliktklausel (XOR/AMO)
+
+    // Gauß-Elimination (nur aktiv, wenn XORs erkannt wurden)
+    XorEngine xorEngine;
+    size_t    xorHead = 0;                              // bis hierhin an die Matrix gemeldet
+    std::vector<std::vector<uint64_t>> xorReason;       // Zeilenkopie je implizierter Variable (lazy Reason)
+    std::vector<XorEngine::Implication> xorImplied;     // Puffer für Implikationen
+    size_t    gauss_max_rows = 3000;                    // größere XOR-Systeme werden nicht eliminiert
+
+    // At-Most-One-Constraints: Zähler-Propagator über die Literale
+    std::vector<std::vector<Literal>> amos;             // Literale je Constraint
+    std::vector<std::vector<int>>     amoOcc;           // pro Literal (litToIndex): Constraint-IDs
+    std::vector<Literal>              amoTrue;          // erstes wahres Literal je Constraint (Var 0 = keines)
+    std::vector<Literal>              amoReason;        // je implizierter Variable: auslösendes wahres Literal
+
+    // Restart (Luby-Folge oder geometrisch)
+    RestartPolicy restartPolicy = RestartPolicy::LUBY;
+    int restart_idx = 1;                 // Index in der Restart-Folge
+    int restart_base = 2;                // Basis-Multiplikator (Luby)
+    double restart_geo_first  = 100.0;   // erstes Budget (geometrisch)
+    double restart_geo_factor = 1.5;     // Wachstumsfaktor (geometrisch)
     int conflicts_since_restart = 0;     // seit letztem Restart gezählte Konflikte
     int restart_budget = 0;              // Konfliktbudget bis zum nächsten Restart
 
+    // Konfliktbudget für den restart_idx-ten Restart
+    int restartBudget() const;
+
+    // Periodische Statusausgabe (alle 1000 Konflikte)
+    bool verbose = true;
+
     // Deletion-Policy (Glucose-Style): Aktivitätsskala der Klauseln
     double clauseInc = 1.0;   // Start-Inkrement
     double clauseDecay = 0.95;// Zerfallsfaktor für clauseInc
 
+    // Reduktionsplan (Glucose-Style): erste Reduktion nach reduce_base gelernten Klauseln,
+    // danach wächst der Abstand pro Reduktion um reduce_inc
+    uint64_t reduce_base  = 2000;
+    uint64_t reduce_inc   = 300;
+    uint64_t reduce_count = 0;
+    uint64_t next_reduce  = 2000;
+
+    // Subsumption gelernter Klauseln nur alle subsume_interval Reduktionen
+    uint64_t subsume_interval = 4;
+
+    // Probing: Budget (Propagationen) als Preprocessing und alle probe_interval Restarts
+    uint64_t probe_budget_pre     = 200000;
+    uint64_t probe_budget_restart = 20000;
+    uint64_t probe_interval       = 50;
+
+    // Vivifikation: Budget (Klausel-Inspektionen) und Abstand in Restarts
+    uint64_t vivify_budget   = 100000;
+    uint64_t vivify_interval = 20;
+
+    // Lokale Suche: Flips vor dem CDCL-Start, dann Rephasing (arithmetisch wachsende Abstände in Konflikten).
+    // Budget je Lauf: Flips pro Klausel, gedeckelt
+    uint64_t ls_flips_pre      = 2000000;
+    uint64_t ls_flips_rephase  = 300000;
+    uint64_t ls_flips_per_clause_pre     = 50;
+    uint64_t ls_flips_per_clause_rephase = 10;
+    uint64_t ls_rephase_base   = 5000;
+    uint64_t ls_rephase_count  = 0;
+    uint64_t ls_next_rephase   = 5000;
+    size_t   ls_amo_max_size   = 64;       // größere AMOs werden nicht paarweise expandiert
+    uint64_t ls_seed           = 0x5eed;
+    std::vector<int> lsModel;                  // Belegung ohne unerfüllte Klausel (leer = keine)
+
+    // Kooperativer Abbruch: von außen gesetztes Flag, wird in der CDCL-Schleife geprüft
+    const std::atomic<bool>* stopFlag = nullptr;
+    bool interrupted = false; // solve() wurde über stopFlag abgebrochen (Ergebnis unbekannt)
+    uint64_t conflictLimit = 0; // Konfliktbudget je solve()-Aufruf (0 = unbegrenzt)
+
+    // Wiederholtes Lösen: Vorverarbeitung einmalig, danach nur noch die CDCL-Schleife
+    bool prepared  = false;
+    bool rootUnsat = false;   // Konflikt auf Level 0: Formel UNSAT (auch für spätere Aufrufe)
+    std::vector<Literal> assumptions; // Annahmen des laufenden Aufrufs (Level i+1 = assumptions[i])
+
+    // Einmalige Vorverarbeitung vor der ersten CDCL-Schleife. false = Formel UNSAT
+    bool prepare();
+
+    // Annahme 'a' ist falsch: beteiligte Annahmen über die Reasons zurückverfolgen
+    void analyzeFinal(const Literal& a);
+    std::vector<Literal> failedAssumptions; // (auf aktive Variablen abgebildete) Annahmen
+
+    // Nach blockModel(): der nächste solve()-Aufruf sucht ab dem Backjump-Level weiter
+    bool resumeSearch = false;
+
+    // Annahme auf eine aktive Variable abbilden (ersetzte Variable → Repräsentant)
+    Literal assumptionLiteral(const Literal& a) const;
+
+    // Klauseltausch: geteilt werden Units, Binärklauseln und Klauseln bis share_max_size
+    // Literale mit LBD <= share_max_lbd. sharedSeen verhindert doppelte Übernahmen:
+    // direkt adressierte Tabelle fester Größe (ein Schlüssel je Slot, neuere verdrängen
+    // ältere), der Speicher bleibt damit auch bei langen Läufen begrenzt
+    ClauseExchange* exchange   = nullptr;
+    size_t          exchangeId = 0;
+    size_t          share_max_size = 8;
+    int             share_max_lbd  = 3;
+    static constexpr size_t kSharedSeenSlots = size_t{1} << 16;
+    std::vector<uint64_t> sharedSeen;
+    std::vector<ClauseExchange::SharedClause> sharedBuf;
+
+    // DRAT-Beweis (nullptr = aus): jede hinzugefügte abgeleitete Klausel und jede Löschung
+    ProofWriter* proof = nullptr;
+    void proofAdd(const std::vector<Literal>& lits);
+    void proofDelete(const std::vector<Literal>& lits);
+    void markRootUnsat(); // rootUnsat setzen, leere Klausel in den Beweis
+
 public:
     // Konstruktor: setzt Größe, initialisiert Heuristik/Strukturen
     explicit Solver(int n);
 
-    // Hauptschleife des Solvers (liefert SAT/UNSAT)
+    // Hauptschleife des Solvers (liefert SAT/UNSAT). Mehrfach aufrufbar: Vorverarbeitung
+    // nur beim ersten Aufruf, gelernte Klauseln/Aktivitäten/Phasen bleiben erhalten.
+    // Mit Annahmen: false = UNSAT unter den Annahmen (isRootUnsat(): auch ohne)
     bool     solve();
+    bool     solve(const std::vector<Literal>& assumptions);
 
     // Optionale alte Propagation O(n*m) (nur zu Vergleichszwecken)
     Clause*  unitPropagation();
@@ -106,15 +363,63 @@ public:
     // Status/IO
     bool allVariablesAssigned() const; // true, wenn alle Variablen belegt sind
     void addClause(const Clause& clause); // Klausel hinzufügen (inkl. Watches setzen)
+    // Eingabeklauseln gesammelt übernehmen (vor solve()): ohne Kopie, Attach und LBD;
+    // die Watch-Listen baut solve() in einem Durchgang auf
+    void loadClauses(std::vector<Clause>&& input);
     void printModel() const;              // Belegung ausgeben
+    std::vector<int> getModel() const;    // Belegung inkl. rekonstruierter eliminierter Variablen
+
+    // Rekonstruktionsstapel einer externen Vorverarbeitung übernehmen (vor solve() aufrufen)
+    void addReconstruction(const Reconstruction& rec);
+
+    // At-Most-One-Constraint hinzufügen (vor solve() aufrufen); friert die Variablen ein
+    void addAtMostOne(const std::vector<Literal>& lits);
+
+    // Variable von Eliminations-/Substitutionsverfahren ausnehmen
+    void freezeVariable(int var);
+
+    // Abbruch-Flag setzen (nullptr = kein Abbruch). solve() liefert dann false und
+    // isInterrupted() == true
+    void setStopFlag(const std::atomic<bool>* flag);
+    bool isInterrupted() const { return interrupted; }
+
+    // Inkrementelle Nutzung: Variablenbereich erweitern und Eingabeklauseln hinzufügen,
+    // auch zwischen zwei solve()-Aufrufen (Klauseln über ersetzten Variablen werden auf den
+    // Repräsentanten abgebildet). false = Formel UNSAT
+    void reserveVars(int n);
+    bool addInputClause(std::vector<Literal> lits);
+    int  getNumVars() const { return numVars; }
+
+    // Modellaufzählung (nach SAT): das aktuelle Modell, eingeschränkt auf 'projection'
+    // (leer = alle Variablen), per Blockklausel ausschließen und nur bis zum zweithöchsten
+    // Level der Klausel zurückspringen. false = keine weiteren Modelle
+    bool blockModel(const std::vector<int>& projection);
+
+    // Nach UNSAT unter Annahmen: war die Annahme an der Widerlegung beteiligt?
+    bool isFailedAssumption(const Literal& a) const;
+
+    // Konfliktbudget je solve()-Aufruf (0 = unbegrenzt); bei Erreichen wie Abbruch
+    void setConflictLimit(uint64_t limit) { conflictLimit = limit; }
+
+    // true, wenn die Formel selbst (ohne Annahmen) widerlegt ist
+    bool isRootUnsat() const { return rootUnsat; }
+
+    // DRAT-Beweis schreiben (vor solve()). Gauß-Elimination bleibt dann aus, da ihre
+    // Implikationen nicht per RUP nachprüfbar sind; Klauseltausch nicht kombinieren
+    void setProof(ProofWriter* writer) { proof = writer; }
+
+    // Klauseltausch aktivieren (vor solve()): dieser Solver ist Worker 'id' der Exchange
+    void setClauseExchange(ClauseExchange* ex, size_t id);
     void printStats() const;              // Statistiken ausgeben
 
     void exportStats(const std::string&) const;             // Statistiken in CSV-Datei schreiben
+    void addStats(const Solver& other) { stats += other.stats; } // Statistiken eines Teil-Solvers aufsummieren
 
     // Neue, effiziente Propagation (Two-Watched-Literals)
     Clause* propagate();
 
-    // Bestehende Klauseln an Watch-Listen hängen (falls bereits im Vektor)
+    // Bestehende Klauseln an Watch-Listen hängen (falls bereits im Vektor).
+    // Zwei Durchgänge: Watches zählen, dann die Listen passend reserviert füllen
     void    attachExistingClauses();
 
     // Root-Level Units vorab enqueuen (Level 0)
@@ -126,6 +431,14 @@ public:
     // Seed für Random-Heuristik setzen
     void setHeuristicSeed(uint64_t s);
 
+    // Restart-Strategie wählen (vor solve())
+    void setRestartPolicy(RestartPolicy policy);
+
+    // Periodische Statusausgabe ein-/ausschalten (z. B. für parallele Worker)
+    void setVerbose(bool v) { verbose = v; }
+    // Einlesezeit für das Laufzeitprofil (Bezug der Anteile: Einlesen + solve())
+    void setParseTime(uint64_t ns) { stats.t_parse_ns = ns; }
+
     // Klauselaktivität erhöhen / Inkrement zerfallen lassen
     void bumpClauseActivity(Clause& c);
     void decayClauseInc();
@@ -0,0 +1,313 @@
+// StreamReader.cpp
+// ----------------
+// Lese-Thread mit Ringpuffer. Dekompression über zlib (gzip, auch mehrere Member),
+// liblzma (xz, auch verkettete Streams) und libbzip2 (auch verkettete Streams, z. B. pbzip2).
+// Welche Formate verfügbar sind, hängt von GUMS_HAVE_ZLIB / GUMS_HAVE_LZMA / GUMS_HAVE_BZIP2 ab.
+
+#include "StreamReader.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifdef GUMS_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef GUMS_HAVE_LZMA
+#include <lzma.h>
+#endif
+#ifdef GUMS_HAVE_BZIP2
+#include <bzlib.h>
+#endif
+
+StreamReader::StreamReader(size_t chunkSize, size_t numSlots)
+    : chunkSize{chunkSize}, slots(numSlots) {}
+
+StreamReader::~StreamReader() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        cancel = true;
+    }
+    notFull.notify_all();
+    if (worker.joinable()) worker.join();
+    if (in != nullptr && in != stdin) std::fclose(in);
+}
+
+bool StreamReader::open(const std::filesystem::path& path) {
+    in = (path == "-") ? stdin : std::fopen(path.c_str(), "rb");
+    if (in == nullptr) return false;
+    worker = std::thread(&StreamReader::run, this);
+    return true;
+}
+
+bool StreamReader::next(std::vector<char>& out) {
+    std::unique_lock<std::mutex> lock(mtx);
+    notEmpty.wait(lock, [&] { return count > 0 || done; });
+    if (count == 0) return false;
+
+    std::swap(out, slots[head]);
+    head = (head + 1) % slots.size();
+    --count;
+    notFull.notify_one();
+    return true;
+}
+
+std::string StreamReader::error() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return err;
+}
+
+StreamReader::Format StreamReader::detect(const unsigned char* m, size_t n) {
+    if (n >= 2 && m[0] == 0x1f && m[1] == 0x8b) return Format::GZIP;
+    if (n >= 6 && std::memcmp(m, "\xFD" "7zXZ\x00", 6) == 0) return Format::XZ;
+    if (n >= 3 && m[0] == 'B' && m[1] == 'Z' && m[2] == 'h') return Format::BZIP2;
+    return Format::PLAIN;
+}
+
+StreamReader::Format StreamReader::detect(const std::filesystem::path& path) {
+    std::ifstream ifs{path, std::ios::binary};
+    unsigned char magic[6] = {};
+    ifs.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    return detect(magic, static_cast<size_t>(ifs.gcount()));
+}
+
+bool StreamReader::push(std::vector<char>& buf) {
+    std::unique_lock<std::mutex> lock(mtx);
+    notFull.wait(lock, [&] { return count < slots.size() || cancel; });
+    if (cancel) return false;
+
+    std::swap(slots[(head + count) % slots.size()], buf);
+    ++count;
+    notEmpty.notify_one();
+    return true;
+}
+
+void StreamReader::finish(std::string error) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        done = true;
+        err  = std::move(error);
+    }
+    notEmpty.notify_all();
+}
+
+void StreamReader::run() {
+    // Die ersten Bytes lesen, um das Format zu bestimmen
+    std::vector<char> raw(chunkSize);
+    size_t pre = 0;
+    while (pre < 6) {
+        const size_t n = std::fread(raw.data() + pre, 1, 6 - pre, in);
+        if (n == 0) break;
+        pre += n;
+    }
+    if (std::ferror(in)) {
+        finish("Lesefehler");
+        return;
+    }
+
+    switch (detect(reinterpret_cast<const unsigned char*>(raw.data()), pre)) {
+        case Format::PLAIN: if (copyPlain(raw, pre)) finish({});   break;
+        case Format::GZIP:  if (inflateGzip(raw, pre)) finish({}); break;
+        case Format::XZ:    if (decodeXz(raw, pre)) finish({});    break;
+        case Format::BZIP2: if (decodeBzip2(raw, pre)) finish({}); break;
+    }
+}
+
+// Klartext: Blöcke unverändert weiterreichen
+bool StreamReader::copyPlain(std::vector<char>& raw, size_t pre) {
+    std::vector<char>& buf = raw;
+    size_t used = pre;
+    while (true) {
+        buf.resize(chunkSize);
+        const size_t n = std::fread(buf.data() + used, 1, chunkSize - used, in);
+        used += n;
+        if (used == 0) break;
+        buf.resize(used);
+        if (!push(buf)) return false;
+        used = 0;
+        if (n == 0) break;
+    }
+    if (std::ferror(in)) {
+        finish("Lesefehler");
+        return false;
+    }
+    return true;
+}
+
+#ifdef GUMS_HAVE_ZLIB
+bool StreamReader::inflateGzip(std::vector<char>& raw, size_t pre) {
+    z_stream zs{};
+    if (inflateInit2(&zs, 15 + 32) != Z_OK) {  // +32: gzip/zlib-Header automatisch erkennen
+        finish("zlib: Initialisierung fehlgeschlagen");
+        return false;
+    }
+
+    std::vector<char> out(chunkSize);
+    zs.next_in   = reinterpret_cast<Bytef*>(raw.data());
+    zs.avail_in  = static_cast<uInt>(pre);
+    zs.next_out  = reinterpret_cast<Bytef*>(out.data());
+    zs.avail_out = static_cast<uInt>(out.size());
+    bool memberEnd = false;
+    std::string error;
+
+    while (error.empty()) {
+        if (zs.avail_in == 0) {
+            const size_t n = std::fread(raw.data(), 1, raw.size(), in);
+            if (n == 0) break;
+            zs.next_in  = reinterpret_cast<Bytef*>(raw.data());
+            zs.avail_in = static_cast<uInt>(n);
+        }
+        // Weitere Daten nach dem Ende eines Members: nächstes gzip-Member
+        if (memberEnd) {
+            inflateReset(&zs);
+            memberEnd = false;
+        }
+
+        const int rc = inflate(&zs, Z_NO_FLUSH);
+        if (rc == Z_STREAM_END) {
+            memberEnd = true;
+        } else if (rc != Z_OK && rc != Z_BUF_ERROR) {
+            error = std::string("zlib: ") + (zs.msg != nullptr ? zs.msg : "Datenfehler");
+        }
+
+        if (zs.avail_out == 0) {
+            if (!push(out)) { inflateEnd(&zs); return false; }
+            out.resize(chunkSize);
+            zs.next_out  = reinterpret_cast<Bytef*>(out.data());
+            zs.avail_out = static_cast<uInt>(out.size());
+        }
+    }
+    inflateEnd(&zs);
+
+    if (error.empty() && std::ferror(in)) error = "Lesefehler";
+    if (error.empty() && !memberEnd)      error = "gzip: unerwartetes Dateiende";
+
+    out.resize(chunkSize - zs.avail_out);
+    if (!out.empty() && !push(out)) return false;
+    if (!error.empty()) { finish(error); return false; }
+    return true;
+}
+#else
+bool StreamReader::inflateGzip(std::vector<char>&, size_t) {
+    finish("gzip-Eingabe nicht unterstützt (ohne zlib gebaut)");
+    return false;
+}
+#endif
+
+#ifdef GUMS_HAVE_LZMA
+bool StreamReader::decodeXz(std::vector<char>& raw, size_t pre) {
+    lzma_stream strm = LZMA_STREAM_INIT;
+    if (lzma_stream_decoder(&strm, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+        finish("xz: Initialisierung fehlgeschlagen");
+        return false;
+    }
+
+    std::vector<char> out(chunkSize);
+    strm.next_in   = reinterpret_cast<const uint8_t*>(raw.data());
+    strm.avail_in  = pre;
+    strm.next_out  = reinterpret_cast<uint8_t*>(out.data());
+    strm.avail_out = out.size();
+    lzma_action action = LZMA_RUN;
+    std::string error;
+
+    while (true) {
+        if (strm.avail_in == 0 && action == LZMA_RUN) {
+            const size_t n = std::fread(raw.data(), 1, raw.size(), in);
+            if (n == 0) action = LZMA_FINISH;  // Ende der Eingabe: Decoder abschließen lassen
+            strm.next_in  = reinterpret_cast<const uint8_t*>(raw.data());
+            strm.avail_in = n;
+        }
+
+        const lzma_ret rc = lzma_code(&strm, action);
+        if (strm.avail_out == 0 || rc == LZMA_STREAM_END) {
+            out.resize(chunkSize - strm.avail_out);
+            if (!out.empty() && !push(out)) { lzma_end(&strm); return false; }
+            out.resize(chunkSize);
+            strm.next_out  = reinterpret_cast<uint8_t*>(out.data());
+            strm.avail_out = out.size();
+        }
+        if (rc == LZMA_STREAM_END) break;
+        if (rc != LZMA_OK) {
+            error = rc == LZMA_BUF_ERROR ? "xz: unerwartetes Dateiende" : "xz: Datenfehler";
+            break;
+        }
+    }
+    lzma_end(&strm);
+
+    if (error.empty() && std::ferror(in)) error = "Lesefehler";
+    if (!error.empty()) { finish(error); return false; }
+    return true;
+}
+#else
+bool StreamReader::decodeXz(std::vector<char>&, size_t) {
+    finish("xz-Eingabe nicht unterstützt (ohne liblzma gebaut)");
+    return false;
+}
+#endif
+
+#ifdef GUMS_HAVE_BZIP2
+bool StreamReader::decodeBzip2(std::vector<char>& raw, size_t pre) {
+    bz_stream bs{};
+    if (BZ2_bzDecompressInit(&bs, 0, 0) != BZ_OK) {
+        finish("bzip2: Initialisierung fehlgeschlagen");
+        return false;
+    }
+
+    std::vector<char> out(chunkSize);
+    bs.next_in   = raw.data();
+    bs.avail_in  = static_cast<unsigned>(pre);
+    bs.next_out  = out.data();
+    bs.avail_out = static_cast<unsigned>(out.size());
+    bool streamEnd = false;
+    std::string error;
+
+    while (error.empty()) {
+        if (bs.avail_in == 0) {
+            const size_t n = std::fread(raw.data(), 1, raw.size(), in);
+            if (n == 0) break;
+            bs.next_in  = raw.data();
+            bs.avail_in = static_cast<unsigned>(n);
+        }
+        // Weitere Daten nach Streamende: verketteter bzip2-Stream
+        if (streamEnd) {
+            BZ2_bzDecompressEnd(&bs);
+            char*    nextIn  = bs.next_in;
+            unsigned availIn = bs.avail_in;
+            char*    nextOut = bs.next_out;
+            unsigned availOut = bs.avail_out;
+            bs = bz_stream{};
+            if (BZ2_bzDecompressInit(&bs, 0, 0) != BZ_OK) { error = "bzip2: Initialisierung fehlgeschlagen"; break; }
+            bs.next_in = nextIn;   bs.avail_in = availIn;
+            bs.next_out = nextOut; bs.avail_out = availOut;
+            streamEnd = false;
+        }
+
+        const int rc = BZ2_bzDecompress(&bs);
+        if (rc == BZ_STREAM_END) {
+            streamEnd = true;
+        } else if (rc != BZ_OK) {
+            error = "bzip2: Datenfehler";
+        }
+
+        if (bs.avail_out == 0) {
+            if (!push(out)) { BZ2_bzDecompressEnd(&bs); return false; }
+            out.resize(chunkSize);
+            bs.next_out  = out.data();
+            bs.avail_out = static_cast<unsigned>(out.size());
+        }
+    }
+    BZ2_bzDecompressEnd(&bs);
+
+    if (error.empty() && std::ferror(in)) error = "Lesefehler";
+    if (error.empty() && !streamEnd)      error = "bzip2: unerwartetes Dateiende";
+
+    out.resize(chunkSize - bs.avail_out);
+    if (!out.empty() && !push(out)) return false;
+    if (!error.empty()) { finish(error); return false; }
+    return true;
+}
+#else
+bool StreamReader::decodeBzip2(std::vector<char>&, size_t) {
+    finish("bzip2-Eingabe nicht unterstützt (ohne libbz2 gebaut)");
+    return false;
+}
+#endif
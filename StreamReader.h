@@ -0,0 +1,76 @@
+
+#ifndef STREAMREADER_H
+#define STREAMREADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Blockweises Lesen einer (ggf. komprimierten) Datei oder von stdin.
+// Ein Hintergrund-Thread liest und dekomprimiert die Eingabe in Blöcke fester Größe und
+// legt sie in einem Ringpuffer mit wenigen Slots ab; der Verbraucher holt sie mit next().
+// Es liegen also nie mehr als numSlots Blöcke gleichzeitig im Speicher.
+// Das Format wird an den ersten Bytes erkannt (gzip, xz, bzip2, sonst Klartext).
+class StreamReader {
+public:
+    enum class Format { PLAIN, GZIP, XZ, BZIP2 };
+
+    explicit StreamReader(size_t chunkSize = size_t{1} << 20, size_t numSlots = 8);
+    ~StreamReader();
+
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    // Datei öffnen ("-" = stdin) und den Lese-Thread starten. false = nicht lesbar
+    bool open(const std::filesystem::path& path);
+
+    // Nächsten Block holen (blockiert bis verfügbar); der bisherige Inhalt von 'out' wird
+    // als Puffer wiederverwendet. false = Ende der Eingabe oder Fehler (siehe error())
+    bool next(std::vector<char>& out);
+
+    // Fehlermeldung des Lese-Threads (leer = kein Fehler)
+    std::string error() const;
+
+    // Format anhand der ersten Bytes einer Datei bestimmen (ohne sie zu öffnen zu halten)
+    static Format detect(const std::filesystem::path& path);
+    static Format detect(const unsigned char* magic, size_t n);
+
+private:
+    size_t chunkSize;
+
+    // Ringpuffer: Slots [head, head + count) sind gefüllt
+    std::vector<std::vector<char>> slots;
+    size_t head  = 0;
+    size_t count = 0;
+    bool   done  = false;     // Produzent fertig (Ende oder Fehler)
+    bool   cancel = false;    // Verbraucher bricht ab (Destruktor)
+    std::string err;
+
+    mutable std::mutex      mtx;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+
+    std::FILE*  in = nullptr;
+    std::thread worker;
+
+    // Lese-Thread: Format erkennen und passenden Dekompressor ausführen
+    void run();
+
+    // Block an den Ringpuffer übergeben (tauscht 'buf' gegen einen freien Puffer).
+    // false = Verbraucher hat abgebrochen
+    bool push(std::vector<char>& buf);
+    void finish(std::string error);
+
+    // Dekompressoren: lesen ab 'in' (die ersten 'pre' Bytes liegen schon in 'raw')
+    bool copyPlain(std::vector<char>& raw, size_t pre);
+    bool inflateGzip(std::vector<char>& raw, size_t pre);
+    bool decodeXz(std::vector<char>& raw, size_t pre);
+    bool decodeBzip2(std::vector<char>& raw, size_t pre);
+};
+
+#endif // STREAMREADER_H
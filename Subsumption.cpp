@@ -0,0 +1,182 @@
+// Subsumption.cpp
+// ----------------
+// Subsumption und Self-Subsuming Resolution über der Klauseldatenbank.
+// Jede Klausel erhält eine 64-Bit-Signatur (ein Bit je Variable mod 64), mit der
+// die meisten Teilmengen-Tests verworfen werden, ohne die Literale anzusehen.
+// Für einen Subsumierer C werden nur die Klauseln aus der kürzesten Occurrence-Liste
+// einer Variable von C geprüft – jede Obermenge von C muss dort enthalten sein.
+
+#include "Subsumption.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+// Ergebnis des Teilmengen-Tests C gegen D
+static constexpr int SUB_NONE     = -2; // kein Zusammenhang
+static constexpr int SUB_SUBSUMES = -1; // C ⊆ D
+// Wert >= 0: Position des Literals in C, dessen Komplement in D liegt (Strengthening)
+
+// Ordnung der Literale in der Arbeitskopie: nach Variable, dann positiv vor negativ
+static bool litLess(const Literal& a, const Literal& b) {
+    if (a.getVar() != b.getVar()) return a.getVar() < b.getVar();
+    return !a.isNegated() && b.isNegated();
+}
+
+// Signatur einer (sortierten) Klausel: ein Bit pro Variable (mod 64)
+static uint64_t signature(const std::vector<Literal>& lits) {
+    uint64_t sig = 0;
+    for (const auto& l : lits) sig |= (1ULL << (static_cast<unsigned>(l.getVar()) & 63U));
+    return sig;
+}
+
+// Teilmengen-Test auf sortierten, duplikatfreien Klauseln (Merge-Verfahren).
+// Erlaubt genau ein komplementäres Literal (Self-Subsuming Resolution).
+static int subsetCheck(const std::vector<Literal>& C, const std::vector<Literal>& D) {
+    int flip = SUB_SUBSUMES;
+    size_t j = 0;
+    for (size_t i = 0; i < C.size(); ++i) {
+        const int v = C[i].getVar();
+        while (j < D.size() && D[j].getVar() < v) ++j;
+        if (j == D.size() || D[j].getVar() != v) return SUB_NONE;
+        if (D[j].isNegated() != C[i].isNegated()) {
+            if (flip != SUB_SUBSUMES) return SUB_NONE; // zweites komplementäres Literal
+            flip = static_cast<int>(i);
+        }
+        ++j;
+    }
+    return flip;
+}
+
+Subsumption::Subsumption(uint64_t stepLimit) : stepLimit{stepLimit} {}
+
+Subsumption::Result Subsumption::run(const std::vector<Clause>& clauses, int numVars,
+                                     const std::vector<bool>& candidate) const {
+    const size_t n = clauses.size();
+    Result res;
+    res.removed.assign(n, false);
+
+    // --- Arbeitskopien: sortiert, ohne doppelte Literale; Tautologien erkennen ---
+    std::vector<std::vector<Literal>> work(n);
+    std::vector<uint64_t> sig(n, 0);
+    std::vector<bool> changed(n, false);
+    for (size_t i = 0; i < n; ++i) {
+        auto& w = work[i];
+        w = clauses[i].getClause();
+        std::sort(w.begin(), w.end(), litLess);
+        w.erase(std::unique(w.begin(), w.end()), w.end());
+
+        bool tautology = false;
+        for (size_t k = 1; k < w.size(); ++k) {
+            if (w[k].getVar() == w[k - 1].getVar()) { tautology = true; break; }
+        }
+        if (!candidate[i]) { sig[i] = signature(w); continue; }
+        if (tautology) {
+            res.removed[i] = true;
+            ++res.removedCount;
+            continue;
+        }
+        if (w.size() != clauses[i].size()) changed[i] = true; // Duplikate entfernt
+        sig[i] = signature(w);
+    }
+
+    // --- Occurrence-Listen (pro Variable) über die Kandidaten ---
+    std::vector<std::vector<size_t>> occ(numVars + 1);
+    for (size_t i = 0; i < n; ++i) {
+        if (!candidate[i] || res.removed[i]) continue;
+        for (const auto& l : work[i]) occ[l.getVar()].push_back(i);
+    }
+
+    // --- Warteschlange der Subsumierer: kurze Klauseln zuerst ---
+    std::vector<size_t> order;
+    order.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (!res.removed[i] && !work[i].empty()) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return work[a].size() < work[b].size();
+    });
+    std::deque<size_t> queue(order.begin(), order.end());
+    std::vector<bool> queued(n, false);
+    for (size_t i : order) queued[i] = true;
+
+    uint64_t steps = 0;
+    std::vector<size_t> cands;
+    while (!queue.empty() && steps < stepLimit) {
+        const size_t c = queue.front();
+        queue.pop_front();
+        queued[c] = false;
+        if (res.removed[c] || work[c].empty()) continue;
+
+        // Variable aus C mit der kürzesten Occurrence-Liste wählen
+        int best = -1;
+        size_t bestLen = std::numeric_limits<size_t>::max();
+        for (const auto& l : work[c]) {
+            const size_t len = occ[l.getVar()].size();
+            if (len < bestLen) { bestLen = len; best = l.getVar(); }
+        }
+        if (best == -1 || bestLen == 0) continue;
+
+        // Kopie, da Strengthening die Liste während der Schleife verändern kann
+        cands = occ[best];
+        for (size_t d : cands) {
+            if (d == c || res.removed[d]) continue;
+            if (work[d].size() < work[c].size()) continue;
+            if ((sig[c] & ~sig[d]) != 0) continue; // Signatur-Vorfilter
+            ++steps;
+
+            const int r = subsetCheck(work[c], work[d]);
+            if (r == SUB_NONE) continue;
+
+            if (r == SUB_SUBSUMES) {
+                res.removed[d] = true;
+                ++res.removedCount;
+                continue;
+            }
+
+            // Self-Subsuming Resolution: Komplement von C[r] aus D entfernen
+            const int pivot = work[c][r].getVar();
+            auto& wd = work[d];
+            const auto it = std::find_if(wd.begin(), wd.end(), [&](const Literal& l) { return l.getVar() == pivot; });
+            res.steps.emplace_back(d, *it);
+            wd.erase(it);
+            auto& ol = occ[pivot];
+            ol.erase(std::find(ol.begin(), ol.end(), d));
+            sig[d] = signature(wd);
+            changed[d] = true;
+            ++res.strengthenedCount;
+
+            // Verkürzte Klausel kann nun selbst weitere Klauseln subsumieren
+            if (!queued[d]) { queue.push_back(d); queued[d] = true; }
+        }
+    }
+
+    res.complete = queue.empty();
+
+    // Endgültige Literale aller veränderten Klauseln übernehmen
+    for (size_t i = 0; i < n; ++i) {
+        if (changed[i] && !res.removed[i]) res.strengthened.emplace_back(i, std::move(work[i]));
+    }
+    return res;
+}
+
+Subsumption::Result Subsumption::simplify(std::vector<Clause>& clauses, int numVars) const {
+    Result res = run(clauses, numVars, std::vector<bool>(clauses.size(), true));
+
+    // Verkürzte Klauseln ersetzen (Watches neu initialisieren)
+    for (auto& [idx, lits] : res.strengthened) {
+        Clause c(std::move(lits));
+        c.initWatchesDefault();
+        clauses[idx] = std::move(c);
+    }
+
+    // Subsumierte Klauseln stabil entfernen
+    size_t j = 0;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        if (res.removed[i]) continue;
+        if (i != j) clauses[j] = std::move(clauses[i]);
+        ++j;
+    }
+    clauses.erase(clauses.begin() + static_cast<std::ptrdiff_t>(j), clauses.end());
+    return res;
+}
@@ -0,0 +1,41 @@
+
+#ifndef SUBSUMPTION_H
+#define SUBSUMPTION_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Subsumption und Self-Subsuming Resolution über einer Klauselmenge.
+//  - C subsumiert D (C ⊆ D)                 → D wird entfernt
+//  - C = A ∨ l, D = B ∨ ¬l mit A ⊆ B         → ¬l wird aus D entfernt (Strengthening)
+class Subsumption {
+public:
+    // Ergebnis eines Laufs (Indizes beziehen sich auf den übergebenen Klauselvektor)
+    struct Result {
+        std::vector<bool> removed;                                       // true = subsumiert/tautologisch
+        std::vector<std::pair<size_t, std::vector<Literal>>> strengthened; // verkürzte Klauseln (Index, neue Literale)
+        size_t removedCount      = 0;                                    // #entfernter Klauseln
+        size_t strengthenedCount = 0;                                    // #entfernter Literale (Strengthening-Schritte)
+        std::vector<std::pair<size_t, Literal>> steps;                   // (Index, entferntes Literal) in Ableitungsreihenfolge
+        bool complete = true;                                            // false = Lauf am stepLimit abgebrochen
+    };
+
+    // stepLimit: maximale Anzahl an Teilmengen-Tests pro Lauf (Laufzeitbudget)
+    explicit Subsumption(uint64_t stepLimit = 20'000'000);
+
+    // Analysiert 'clauses'. Nur Klauseln mit candidate[i] == true dürfen entfernt oder
+    // verkürzt werden; alle übrigen Klauseln dienen ausschließlich als Subsumierer.
+    Result run(const std::vector<Clause>& clauses, int numVars, const std::vector<bool>& candidate) const;
+
+    // Preprocessing-Einstieg: alle Klauseln sind Kandidaten, das Ergebnis wird direkt
+    // auf 'clauses' angewendet. Entsteht die leere Klausel, bleibt sie im Vektor (→ UNSAT).
+    Result simplify(std::vector<Clause>& clauses, int numVars) const;
+
+private:
+    uint64_t stepLimit;
+};
+
+#endif // SUBSUMPTION_H
@@ -0,0 +1,326 @@
+// Symmetry.cpp
+// -------------
+// Symmetrieerkennung über Partitionsverfeinerung (Color Refinement) mit
+// Individualisierung, ähnlich der Suche in saucy/nauty, aber stark vereinfacht:
+//  - Verfeinerung: neue Farbe = (alte Farbe, Hash der Nachbarfarben), kanonisch
+//    sortiert. Der "Trace" (Histogramm jeder Runde) muss auf beiden Seiten gleich sein.
+//  - Generatoren entlang des ersten Pfads: in der Zielzelle wird x fest individualisiert
+//    und gegen jedes y derselben Zelle (noch nicht im selben Orbit) gesucht.
+//  - Jede gefundene Abbildung wird gegen alle Kanten geprüft, Hash-Kollisionen
+//    können also keine falschen Symmetrien erzeugen.
+
+#include "Symmetry.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+uint64_t mix(uint64_t x) {
+    // splitmix64-Finalizer
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Ungerichteter Graph in CSR-Form, Nachbarn sortiert
+struct Graph {
+    int V = 0;
+    std::vector<int> start;
+    std::vector<int> adj;
+
+    bool hasEdge(int a, int b) const {
+        return std::binary_search(adj.begin() + start[a], adj.begin() + start[a + 1], b);
+    }
+};
+
+// Partition als Färbung mit dichten Farben 0..numColors-1
+struct Coloring {
+    std::vector<int> color;
+    int numColors = 0;
+};
+
+class AutomorphismSearch {
+public:
+    AutomorphismSearch(const Graph& g, uint64_t workLimit) : g{g}, workLimit{workLimit} {}
+
+    bool exhausted() const { return work > workLimit; }
+
+    // Neuer Suchversuch (x ↦ y): Zähler für Fehlversuche zurücksetzen
+    void startAttempt() { branches = 0; }
+
+    // Neue, eindeutige Farbe für v
+    static void individualize(Coloring& c, int v) { c.color[v] = c.numColors++; }
+
+    // Bis zur Stabilität verfeinern; Histogramm jeder Runde landet im Trace
+    void refine(Coloring& c, std::vector<uint64_t>& trace) {
+        const int V = g.V;
+        std::vector<uint64_t> h(V);
+        std::vector<int> order(V);
+        std::vector<int> next(V);
+        while (!exhausted()) {
+            for (int v = 0; v < V; ++v) {
+                uint64_t s = 0;
+                for (int e = g.start[v]; e < g.start[v + 1]; ++e) s += mix(static_cast<uint64_t>(c.color[g.adj[e]]));
+                h[v] = s;
+            }
+            work += g.adj.size() + V;
+
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](int a, int b) {
+                if (c.color[a] != c.color[b]) return c.color[a] < c.color[b];
+                return h[a] < h[b];
+            });
+
+            int count = 0;
+            uint64_t round = 0;
+            size_t classSize = 0;
+            for (int i = 0; i < V; ++i) {
+                const int v = order[i];
+                if (i > 0) {
+                    const int u = order[i - 1];
+                    if (c.color[u] != c.color[v] || h[u] != h[v]) {
+                        round = mix(round ^ mix(classSize));
+                        classSize = 0;
+                        ++count;
+                    }
+                }
+                if (classSize == 0) round = mix(round ^ (static_cast<uint64_t>(c.color[v]) << 32) ^ h[v]);
+                ++classSize;
+                next[v] = count;
+            }
+            round = mix(round ^ mix(classSize));
+            ++count;
+            trace.push_back(round);
+
+            if (count == c.numColors) break; // keine Zelle mehr geteilt
+            c.color.swap(next);
+            c.numColors = count;
+        }
+    }
+
+    // Zielzelle: kleinste Zelle mit mehr als einem Element (-1 = Partition diskret)
+    int targetCell(const Coloring& c) const {
+        std::vector<int> size(c.numColors, 0);
+        for (int col : c.color) ++size[col];
+        int best = -1;
+        for (int col = 0; col < c.numColors; ++col) {
+            if (size[col] > 1 && (best == -1 || size[col] < size[best])) best = col;
+        }
+        return best;
+    }
+
+    // Automorphismus zu zwei gleich verfeinerten Partitionen suchen (Tiefensuche)
+    bool findAutomorphism(const Coloring& L, const Coloring& R, std::vector<int>& perm) {
+        const int cell = targetCell(L);
+        if (cell == -1) {
+            // Diskret: Farbe i links ↦ Farbe i rechts
+            std::vector<int> right(g.V);
+            for (int v = 0; v < g.V; ++v) right[R.color[v]] = v;
+            perm.assign(g.V, -1);
+            for (int v = 0; v < g.V; ++v) perm[v] = right[L.color[v]];
+            return verify(perm);
+        }
+
+        int x = -1;
+        for (int v = 0; v < g.V && x == -1; ++v) if (L.color[v] == cell) x = v;
+
+        Coloring L2 = L;
+        individualize(L2, x);
+        std::vector<uint64_t> traceL;
+        refine(L2, traceL);
+
+        // Kandidaten in der Zelle rechts, x zuerst (Fixpunkte sind am häufigsten)
+        std::vector<int> cands;
+        if (R.color[x] == cell) cands.push_back(x);
+        for (int v = 0; v < g.V; ++v) if (R.color[v] == cell && v != x) cands.push_back(v);
+
+        for (int y : cands) {
+            // Budget je Versuch: ohne Symmetrie verzweigt die Suche sonst exponentiell
+            if (exhausted() || ++branches > maxBranches) return false;
+            Coloring R2 = R;
+            individualize(R2, y);
+            std::vector<uint64_t> traceR;
+            refine(R2, traceR);
+            work += g.V;
+            if (traceL != traceR || L2.numColors != R2.numColors) continue;
+            if (findAutomorphism(L2, R2, perm)) return true;
+        }
+        return false;
+    }
+
+    // Kantenerhaltung prüfen
+    bool verify(const std::vector<int>& perm) {
+        for (int v = 0; v < g.V; ++v) {
+            const int pv = perm[v];
+            if (g.start[pv + 1] - g.start[pv] != g.start[v + 1] - g.start[v]) return false;
+            for (int e = g.start[v]; e < g.start[v + 1]; ++e) {
+                if (!g.hasEdge(pv, perm[g.adj[e]])) return false;
+            }
+        }
+        work += g.adj.size();
+        return true;
+    }
+
+private:
+    static constexpr int maxBranches = 64;
+
+    const Graph& g;
+    uint64_t     workLimit;
+    uint64_t     work = 0;
+    int          branches = 0;
+};
+
+// Union-Find für die Orbits der gefundenen Gruppe
+int findRoot(std::vector<int>& parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+Literal nodeToLit(int node) {
+    return Literal(node / 2 + 1, (node & 1) != 0);
+}
+
+} // namespace
+
+SymmetryBreaker::SymmetryBreaker(int depth, uint64_t workLimit, size_t maxNodes)
+    : depth{depth}, workLimit{workLimit}, maxNodes{maxNodes} {}
+
+SymmetryBreaker::Result SymmetryBreaker::run(std::vector<Clause>& clauses, int numVars) const {
+    Result res;
+    const int L = 2 * numVars;                      // Literal-Knoten: 2*(var-1) + neg
+    const size_t V = static_cast<size_t>(L) + clauses.size(); // danach ein Knoten je Klausel
+    if (numVars == 0 || V > maxNodes) {
+        res.complete = false;
+        return res;
+    }
+
+    // --- Graph aufbauen ---
+    auto litNode = [](const Literal& l) { return 2 * (l.getVar() - 1) + (l.isNegated() ? 1 : 0); };
+    Graph g;
+    g.V = static_cast<int>(V);
+    std::vector<std::vector<int>> nb(V);
+    for (int v = 0; v < L; v += 2) {
+        nb[v].push_back(v + 1);
+        nb[v + 1].push_back(v);
+    }
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        const int cn = L + static_cast<int>(i);
+        for (const auto& l : clauses[i].getClause()) {
+            nb[cn].push_back(litNode(l));
+            nb[litNode(l)].push_back(cn);
+        }
+    }
+    g.start.assign(V + 1, 0);
+    for (size_t v = 0; v < V; ++v) {
+        auto& n = nb[v];
+        std::sort(n.begin(), n.end());
+        n.erase(std::unique(n.begin(), n.end()), n.end());
+        g.start[v + 1] = g.start[v] + static_cast<int>(n.size());
+    }
+    g.adj.reserve(g.start[V]);
+    for (auto& n : nb) {
+        g.adj.insert(g.adj.end(), n.begin(), n.end());
+        std::vector<int>().swap(n);
+    }
+
+    // --- Startfärbung: Literale / Klauseln ---
+    AutomorphismSearch search(g, workLimit);
+    Coloring P;
+    P.color.assign(V, 0);
+    for (size_t v = L; v < V; ++v) P.color[v] = 1;
+    P.numColors = clauses.empty() ? 1 : 2;
+    std::vector<uint64_t> trace;
+    search.refine(P, trace);
+
+    // --- Generatoren entlang des ersten Pfads ---
+    std::vector<int> orbit(V);
+    std::iota(orbit.begin(), orbit.end(), 0);
+    std::vector<std::vector<int>> generators;
+    std::vector<int> perm;
+
+    while (!search.exhausted()) {
+        const int cell = search.targetCell(P);
+        if (cell == -1) break;
+
+        std::vector<int> members;
+        for (size_t v = 0; v < V; ++v) if (P.color[v] == cell) members.push_back(static_cast<int>(v));
+        const int x = members.front();
+
+        Coloring Lc = P;
+        AutomorphismSearch::individualize(Lc, x);
+        std::vector<uint64_t> traceL;
+        search.refine(Lc, traceL);
+
+        for (size_t k = 1; k < members.size() && !search.exhausted(); ++k) {
+            const int y = members[k];
+            if (findRoot(orbit, y) == findRoot(orbit, x)) continue; // bereits im selben Orbit
+
+            Coloring Rc = P;
+            AutomorphismSearch::individualize(Rc, y);
+            std::vector<uint64_t> traceR;
+            search.refine(Rc, traceR);
+            if (traceL != traceR || Lc.numColors != Rc.numColors) continue;
+
+            search.startAttempt();
+            if (search.findAutomorphism(Lc, Rc, perm)) {
+                generators.push_back(std::vector<int>(perm.begin(), perm.begin() + L));
+                for (size_t v = 0; v < V; ++v) {
+                    const int a = findRoot(orbit, static_cast<int>(v));
+                    const int b = findRoot(orbit, perm[v]);
+                    if (a != b) orbit[a] = b;
+                }
+            }
+        }
+
+        // Stabilisator von x: eine Ebene tiefer weitersuchen
+        P = std::move(Lc);
+    }
+    res.complete = !search.exhausted();
+    res.generators = generators.size();
+
+    // --- Lex-Leader-Klauseln: x ≤lex π(x) über den ersten 'depth' bewegten Variablen ---
+    for (const auto& pi : generators) {
+        std::vector<std::pair<Literal, Literal>> chain; // (x_i, π(x_i))
+        for (int v = 1; v <= numVars && static_cast<int>(chain.size()) < depth; ++v) {
+            const int node = 2 * (v - 1);
+            if (pi[node] == node) continue;
+            chain.emplace_back(Literal(v, false), nodeToLit(pi[node]));
+        }
+
+        for (size_t i = 0; i < chain.size(); ++i) {
+            const auto& [xi, pi_i] = chain[i];
+            // (x_j ≡ π(x_j) für alle j < i) → (¬x_i ∨ π(x_i));
+            // ¬(a ≡ b) = (a ∨ b) ∧ (¬a ∨ ¬b) ergibt 2^i Klauseln
+            for (uint32_t mask = 0; mask < (1U << i); ++mask) {
+                std::vector<Literal> lits{Literal(xi.getVar(), true), pi_i};
+                for (size_t j = 0; j < i; ++j) {
+                    const auto& [xj, pj] = chain[j];
+                    if (mask & (1U << j)) {
+                        lits.push_back(xj);
+                        lits.push_back(pj);
+                    } else {
+                        lits.emplace_back(xj.getVar(), true);
+                        lits.emplace_back(pj.getVar(), !pj.isNegated());
+                    }
+                }
+
+                // Duplikate entfernen, Tautologien verwerfen
+                std::vector<Literal> out;
+                bool tautology = false;
+                for (const auto& l : lits) {
+                    if (std::ranges::find(out, Literal(l.getVar(), !l.isNegated())) != out.end()) { tautology = true; break; }
+                    if (std::ranges::find(out, l) == out.end()) out.push_back(l);
+                }
+                if (tautology) continue;
+                clauses.emplace_back(std::move(out));
+                ++res.addedClauses;
+            }
+        }
+    }
+    return res;
+}
@@ -0,0 +1,39 @@
+
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include <cstdint>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Statische Symmetrieerkennung mit Lex-Leader-Symmetry-Breaking.
+// Die Formel wird als gefärbter Graph dargestellt (Knoten: Literale und Klauseln;
+// Kanten: l — ¬l und Klausel — enthaltene Literale). Automorphismen dieses Graphen
+// sind Symmetrien der Formel. Generatoren werden mit Partitionsverfeinerung und
+// Individualisierung gesucht und vor der Ausgabe gegen die Kanten verifiziert.
+// Für jeden Generator π wird x ≤lex π(x) über den ersten 'depth' bewegten Variablen
+// (Variablenreihenfolge nach Index) ohne Hilfsvariablen kodiert.
+class SymmetryBreaker {
+public:
+    struct Result {
+        size_t generators   = 0;  // #gefundener (verifizierter) Generatoren
+        size_t addedClauses = 0;  // #hinzugefügter Symmetry-Breaking-Klauseln
+        bool   complete     = true; // false = Suchbudget erschöpft
+    };
+
+    // depth:      Länge der Lex-Leader-Kette pro Generator (2^(depth) - 1 Klauseln)
+    // workLimit:  maximale Anzahl besuchter Kanten während der Verfeinerung (Laufzeitbudget)
+    // maxNodes:   größere Graphen werden nicht untersucht
+    explicit SymmetryBreaker(int depth = 3, uint64_t workLimit = 50'000'000, size_t maxNodes = 1'000'000);
+
+    // Generatoren suchen und Lex-Leader-Klauseln an 'clauses' anhängen
+    Result run(std::vector<Clause>& clauses, int numVars) const;
+
+private:
+    int      depth;
+    uint64_t workLimit;
+    size_t   maxNodes;
+};
+
+#endif // SYMMETRY_H
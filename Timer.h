@@ -1,30 +1,61 @@
 
-
 #ifndef CDCL_SOLVER_TIMER_H
 #define CDCL_SOLVER_TIMER_H
 
 #include <chrono>
 #include <cstdint>
 
-// Misst die Zeitspanne zwischen Konstruktor- und Destruktoraufruf
-// und addiert sie zu einer Referenzvariablen
+// Laufzeitprofil der heißen Pfade (BCP, Analyse, Entscheidungen, ...).
+// Schalter zur Übersetzungszeit: GUMS_PROFILE=0 (CMake-Option GUMS_PROFILE=OFF) entfernt alle
+// Messpunkte vollständig, die Zeitfelder in Stats bleiben dann 0.
+#ifndef GUMS_PROFILE
+#define GUMS_PROFILE 1
+#endif
+
+// Misst die Zeitspanne zwischen Konstruktor- und Destruktoraufruf in Nanosekunden
+// (steady_clock: monoton, auf Linux/x86 über vDSO/TSC ohne Systemaufruf)
+// und addiert sie zu einer Referenzvariablen. Gezählt wird nur die eigene Zeit: Zeit in
+// verschachtelten Messpunkten (z. B. BCP während des Probings) wird dem inneren Scope
+// zugerechnet und beim umschließenden abgezogen, die Phasen überlappen also nicht.
 struct ScopedTimer {
     uint64_t& acc; // Zielvariable, in die die gemessene Zeit addiert wird
+    ScopedTimer* const parent; // umschließender Messpunkt dieses Threads (nullptr = keiner)
+    uint64_t nested = 0;       // Zeit in inneren Messpunkten
     const std::chrono::steady_clock::time_point t0; // Startzeit
 
     // Konstruktor: startet den Timer und merkt sich Referenz auf die Zielvariable
     explicit ScopedTimer(uint64_t& a)
-        : acc(a), t0(std::chrono::steady_clock::now()) {}
+        : acc(a), parent(current), t0(std::chrono::steady_clock::now()) {
+        current = this;
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
 
     // Destruktor: wird beim Verlassen des Scopes aufgerufen,
-    // berechnet die verstrichene Zeit in Millisekunden und addiert sie zu acc
+    // berechnet die verstrichene Zeit in Nanosekunden und addiert den eigenen Anteil zu acc
     ~ScopedTimer() noexcept {
-        acc += static_cast<uint64_t>(
-            std::chrono::duration_cast<std::chrono::milliseconds>(
+        const auto elapsed = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
                 std::chrono::steady_clock::now() - t0
             ).count()
         );
+        acc += elapsed - nested;
+        if (parent != nullptr) parent->nested += elapsed;
+        current = parent;
     }
+
+private:
+    static inline thread_local ScopedTimer* current = nullptr; // innerster aktiver Messpunkt
 };
 
-#endif // CDCL_SOLVER_TIMER_H
\ No newline at end of file
+// Messpunkt für den umgebenden Scope (ohne GUMS_PROFILE: leer)
+#if GUMS_PROFILE
+#define GUMS_PROFILE_CAT_(a, b) a##b
+#define GUMS_PROFILE_CAT(a, b)  GUMS_PROFILE_CAT_(a, b)
+#define PROFILE_SCOPE(acc) const ScopedTimer GUMS_PROFILE_CAT(_profile_, __LINE__)(acc)
+#else
+#define PROFILE_SCOPE(acc) static_cast<void>(0)
+#endif
+
+#endif // CDCL_SOLVER_TIMER_H
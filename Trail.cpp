@@ -43,6 +43,15 @@ int Trail::getReasonIndexOfVar(int var) const {
     return -1; // Variable noch nicht zugewiesen
 }
 
+// Reason-Indizes an eine kompaktierte Klauseldatenbank anpassen
+void Trail::remapReasons(const std::vector<int>& newIndex) {
+    for (auto& e : trail) {
+        if (e.reason_idx >= 0 && e.reason_idx < static_cast<int>(newIndex.size())) {
+            e.reason_idx = newIndex[e.reason_idx];
+        }
+    }
+}
+
 // Entfernt alle Einträge mit Level > given level (Backtracking) und gibt die betroffenen Variablen zurück
 std::vector<int> Trail::popAboveLevel(int level) {
     std::vector<int> popped;
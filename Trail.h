@@ -14,13 +14,16 @@ private:
     struct TrailEntry {
         Literal lit;       // zugewiesenes Literal
         int     level;     // Entscheidungsebene
-        int     reason_idx; // Index der Reason-Klausel im Solver::clauses; -1 = direkte Entscheidung
+        int     reason_idx; // Index der Reason-Klausel im Solver::clauses; -1 = direkte Entscheidung, LAZY_REASON = Erklärung auf Anfrage
     };
 
     // Alle bisherigen Zuweisungen in zeitlicher Reihenfolge
     std::vector<TrailEntry> trail;
 
 public:
+    // Reason wird erst bei Bedarf erzeugt (z. B. aus einer XOR-Zeile)
+    static constexpr int LAZY_REASON = -2;
+
     // Neues Literal zuweisen und im Trail speichern
     void assign(const Literal& lit, int level, int reason_idx);
 
@@ -40,6 +43,10 @@ public:
     // -1, falls Entscheidung oder nicht vorhanden
     int  getReasonIndexOfVar(int var) const;
 
+    // Reason-Indizes nach dem Kompaktieren der Klauseldatenbank umschreiben
+    // newIndex[alt] = neuer Index (-1 = Klausel wurde entfernt)
+    void remapReasons(const std::vector<int>& newIndex);
+
     // Entfernt alle Einträge oberhalb eines Levels (Backtracking)
     // und gibt die entfernten Variablen zurück
     std::vector<int> popAboveLevel(int level);
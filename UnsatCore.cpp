@@ -0,0 +1,123 @@
+// UnsatCore.cpp
+// -------------
+// Selektoren liegen hinter den Variablen der Formel (numVars + 1 + g) und sind eingefroren,
+// damit die Äquivalenz-Substitution sie nicht ersetzt.
+
+#include "UnsatCore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+UnsatCore::Result UnsatCore::extract(Solver& solver, int numVars, const std::vector<Clause>& clauses,
+                                     const std::vector<size_t>& groupOf) const {
+    Result res;
+    size_t numGroups = groupOf.empty() ? clauses.size() : 0;
+    for (size_t g : groupOf) numGroups = std::max(numGroups, g + 1);
+
+    auto selector = [&](size_t g) { return Literal(numVars + 1 + static_cast<int>(g), false); };
+    solver.reserveVars(numVars + static_cast<int>(numGroups));
+    for (size_t g = 0; g < numGroups; ++g) solver.freezeVariable(selector(g).getVar());
+
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        std::vector<Literal> lits{Literal(selector(groupOf.empty() ? i : groupOf[i]).getVar(), true)};
+        const auto& c = clauses[i].getClause();
+        lits.insert(lits.end(), c.begin(), c.end());
+        solver.addInputClause(std::move(lits));
+    }
+
+    // Lösen unter den Selektoren von 'groups'; bei UNSAT die beteiligten Gruppen. Notwendige
+    // Gruppen sind als Unit auf Level 0 gesetzt und tauchen daher nie als failed auf.
+    std::vector<bool> necessary(numGroups, false);
+    std::vector<Literal> assumptions;
+    auto solveWith = [&](const std::vector<size_t>& groups, std::vector<size_t>& core) -> int {
+        assumptions.clear();
+        for (size_t g : groups) assumptions.push_back(selector(g));
+        ++res.solves;
+        if (solver.solve(assumptions)) return 1;
+        if (solver.isInterrupted()) return 0;
+        core.clear();
+        for (size_t g : groups) {
+            if (necessary[g] || solver.isFailedAssumption(selector(g))) core.push_back(g);
+        }
+        return -1;
+    };
+
+    std::vector<size_t> all(numGroups);
+    for (size_t g = 0; g < numGroups; ++g) all[g] = g;
+    std::vector<size_t> core;
+    if (solveWith(all, core) != -1) return res;
+    res.unsat = true;
+    res.initialSize = core.size();
+
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(opts.trimSeconds));
+    auto timeLeft = [&] { return opts.trimSeconds > 0 && std::chrono::steady_clock::now() < deadline; };
+
+    // 1) Kern-Iteration: der Kern des Kerns ist oft kleiner
+    std::vector<size_t> next;
+    while (timeLeft() && solveWith(core, next) == -1 && next.size() < core.size()) {
+        core.swap(next);
+    }
+
+    // 2) Weglassen; notwendige Gruppen werden fest gesetzt, weggelassene abgeschaltet
+    if (timeLeft()) {
+        bool exhausted = false;
+        solver.setConflictLimit(opts.conflictBudget);
+        for (size_t k = 0; k < core.size();) {
+            if (!timeLeft()) {
+                exhausted = true;
+                break;
+            }
+            const size_t g = core[k];
+            if (necessary[g]) {
+                ++k;
+                continue;
+            }
+            std::vector<size_t> rest;
+            for (size_t h : core) {
+                if (h != g) rest.push_back(h);
+            }
+            const int r = solveWith(rest, next);
+            if (r == -1) {
+                // Weiterhin UNSAT: alle nicht beteiligten Gruppen fallen weg
+                for (size_t h : core) {
+                    if (!std::ranges::binary_search(next, h)) solver.addInputClause({Literal(selector(h).getVar(), true)});
+                }
+                core.swap(next);
+                k = 0;
+                continue;
+            }
+            if (r == 1) {
+                necessary[g] = true;
+                solver.addInputClause({selector(g)});
+            } else {
+                exhausted = true; // Budget erschöpft: Gruppe bleibt, Minimalität offen
+            }
+            ++k;
+        }
+        solver.setConflictLimit(0);
+        res.minimal = !exhausted;
+    }
+
+    res.groups = std::move(core);
+    return res;
+}
+
+bool UnsatCore::writeDimacs(const std::filesystem::path& path, int numVars, const std::vector<Clause>& clauses,
+                            const std::vector<size_t>& groupOf, const Result& res) {
+    std::ofstream out{path, std::ios::out | std::ios::trunc};
+    if (!out.is_open()) return false;
+
+    std::vector<size_t> picked;
+    for (size_t i = 0; i < clauses.size(); ++i) {
+        if (std::ranges::binary_search(res.groups, groupOf.empty() ? i : groupOf[i])) picked.push_back(i);
+    }
+    out << "p cnf " << numVars << ' ' << picked.size() << "\n";
+    for (size_t i : picked) {
+        for (const auto& l : clauses[i].getClause()) out << l.toInt() << ' ';
+        out << "0\n";
+    }
+    return out.good();
+}
@@ -0,0 +1,49 @@
+
+#ifndef UNSATCORE_H
+#define UNSATCORE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include "Clause.h"
+#include "Solver.h"
+
+// UNSAT-Kern über Selektor-Literale.
+// Jede Klauselgruppe g erhält eine frische Variable s_g; jede Klausel C der Gruppe wird als
+// (¬s_g ∨ C) hinzugefügt und unter den Annahmen s_g gelöst. Die beteiligten (failed)
+// Annahmen bilden den Kern. Optional wird er innerhalb eines Zeitbudgets verkleinert:
+//  1) erneut nur unter den Kern-Selektoren lösen, solange der Kern schrumpft
+//  2) gruppenweise weglassen (mit Konfliktbudget): UNSAT → Gruppe fällt weg (Unit ¬s_g),
+//     SAT → Gruppe ist notwendig (Unit s_g)
+// Sind alle Gruppen ohne Budgetabbruch geprüft, ist der Kern minimal (MUS).
+class UnsatCore {
+public:
+    struct Options {
+        double   trimSeconds    = 0;     // Budget für die Verkleinerung (0 = nur der erste Kern)
+        uint64_t conflictBudget = 20000; // Konflikte je Weglass-Test
+    };
+
+    struct Result {
+        bool unsat   = false;            // Formel unerfüllbar (sonst gibt es keinen Kern)
+        bool minimal = false;            // jede Gruppe des Kerns ist notwendig
+        std::vector<size_t> groups;      // Kern-Gruppen, aufsteigend
+        size_t   initialSize = 0;        // Größe des ersten Kerns
+        uint64_t solves      = 0;        // #solve()-Aufrufe
+    };
+
+    explicit UnsatCore(Options opts) : opts{opts} {}
+
+    // Klauseln mit Selektoren in den (frischen) Solver laden und den Kern bestimmen.
+    // groupOf[i] = Gruppe der Klausel i (leer = jede Klausel ist eine eigene Gruppe)
+    Result extract(Solver& solver, int numVars, const std::vector<Clause>& clauses,
+                   const std::vector<size_t>& groupOf = {}) const;
+
+    // Kern-Klauseln als DIMACS schreiben (alle Klauseln der Kern-Gruppen)
+    static bool writeDimacs(const std::filesystem::path& path, int numVars, const std::vector<Clause>& clauses,
+                            const std::vector<size_t>& groupOf, const Result& res);
+
+private:
+    Options opts;
+};
+
+#endif // UNSATCORE_H
@@ -0,0 +1,247 @@
+// XorEngine.cpp
+// --------------
+// Erkennung von XOR-Constraints in der CNF und deren Propagation per
+// inkrementeller Gauß-Jordan-Elimination auf einer bitgepackten Matrix.
+//
+// Invariante: Jede Zeile mit Pivot besitzt eine unbelegte Pivot-Spalte, die in
+// keiner anderen Zeile gesetzt ist. Wird eine Pivot-Variable belegt, bekommt die
+// Zeile eine neue unbelegte Pivot-Spalte (die aus allen anderen Zeilen eliminiert
+// wird). Nach einem Backtrack erhalten pivotlose Zeilen mit wieder unbelegten
+// Spalten erneut ein Pivot. Eine vollständige Neuberechnung ist nie nötig.
+
+#include "XorEngine.h"
+
+#include <algorithm>
+#include <bit>
+#include <map>
+
+// ======================= ERKENNUNG =======================
+
+std::vector<XorEngine::Xor> XorEngine::detect(const std::vector<Clause>& clauses, int maxSize) {
+    // Variablenmenge (sortiert) → gesehene Vorzeichenmuster (Bit i = i-te Variable negiert)
+    std::map<std::vector<int>, std::vector<uint32_t>> groups;
+
+    for (const auto& c : clauses) {
+        if (c.isLearnt()) continue;
+        const int k = static_cast<int>(c.size());
+        if (k < 3 || k > maxSize) continue;
+
+        std::vector<Literal> lits = c.getClause();
+        std::sort(lits.begin(), lits.end(), [](const Literal& a, const Literal& b) {
+            return a.getVar() < b.getVar();
+        });
+        std::vector<int> vars;
+        uint32_t mask = 0;
+        bool duplicate = false;
+        for (int i = 0; i < k; ++i) {
+            if (i > 0 && lits[i].getVar() == lits[i - 1].getVar()) { duplicate = true; break; }
+            vars.push_back(lits[i].getVar());
+            if (lits[i].isNegated()) mask |= (1U << i);
+        }
+        if (duplicate) continue;
+        groups[std::move(vars)].push_back(mask);
+    }
+
+    std::vector<Xor> xors;
+    for (auto& [vars, masks] : groups) {
+        const size_t need = size_t{1} << (vars.size() - 1);
+        if (masks.size() < need) continue;
+        std::sort(masks.begin(), masks.end());
+        masks.erase(std::unique(masks.begin(), masks.end()), masks.end());
+
+        // Muster nach Parität trennen; eine Paritätsklasse muss vollständig sein
+        size_t even = 0, odd = 0;
+        for (uint32_t m : masks) (std::popcount(m) % 2 == 0 ? even : odd)++;
+
+        // Eine Klausel verbietet die Belegung x_i = neg_i. Sind alle Muster der Parität p
+        // verboten, gilt x_1 ⊕ ... ⊕ x_k = 1 - p
+        if (even == need) xors.push_back({vars, true});
+        if (odd == need)  xors.push_back({vars, false});
+    }
+    return xors;
+}
+
+// ======================= MATRIX =======================
+
+void XorEngine::init(const std::vector<Xor>& xors, int numVars) {
+    rows.clear(); rhs.clear(); pivot.clear(); colPivotRow.clear();
+    colToVar.clear();
+    varToCol.assign(numVars + 1, -1);
+    touched.clear(); touchedList.clear(); pendingPivot.clear();
+    if (xors.empty()) return;
+
+    for (const auto& x : xors) {
+        for (int v : x.vars) {
+            if (varToCol[v] == -1) {
+                varToCol[v] = static_cast<int>(colToVar.size());
+                colToVar.push_back(v);
+            }
+        }
+    }
+    const int cols = static_cast<int>(colToVar.size());
+    words = (static_cast<size_t>(cols) + 63) / 64;
+
+    unassignedMask.assign(words, 0);
+    trueMask.assign(words, 0);
+    for (int c = 0; c < cols; ++c) unassignedMask[c >> 6] |= (1ULL << (c & 63));
+
+    for (const auto& x : xors) {
+        std::vector<uint64_t> r(words, 0);
+        for (int v : x.vars) {
+            const int c = varToCol[v];
+            r[c >> 6] ^= (1ULL << (c & 63));
+        }
+        rows.push_back(std::move(r));
+        rhs.push_back(x.rhs ? 1 : 0);
+    }
+    pivot.assign(rows.size(), -1);
+    colPivotRow.assign(cols, -1);
+    touched.assign(rows.size(), false);
+
+    // Gauß-Jordan: jede Zeile erhält (falls möglich) ein Pivot
+    for (int r = 0; r < static_cast<int>(rows.size()); ++r) {
+        const int c = findUnassignedCol(r, -1);
+        if (c != -1) makePivot(r, c);
+        touch(r);
+    }
+}
+
+// Zeile zur Prüfung vormerken
+void XorEngine::touch(int r) {
+    if (!touched[r]) {
+        touched[r] = true;
+        touchedList.push_back(r);
+    }
+}
+
+// Erste unbelegte Spalte einer Zeile (ohne 'exclude'), -1 wenn keine
+int XorEngine::findUnassignedCol(int r, int exclude) const {
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t bits = rows[r][w] & unassignedMask[w];
+        while (bits) {
+            const int c = static_cast<int>(w * 64) + std::countr_zero(bits);
+            if (c != exclude) return c;
+            bits &= bits - 1;
+        }
+    }
+    return -1;
+}
+
+// Spalte 'col' zum Pivot von Zeile r machen und aus allen anderen Zeilen eliminieren
+void XorEngine::makePivot(int r, int col) {
+    pivot[r] = col;
+    colPivotRow[col] = r;
+    for (int o = 0; o < static_cast<int>(rows.size()); ++o) {
+        if (o == r || !testBit(rows[o], col)) continue;
+        for (size_t w = 0; w < words; ++w) rows[o][w] ^= rows[r][w];
+        rhs[o] ^= rhs[r];
+        touch(o);
+    }
+}
+
+void XorEngine::assign(int var, bool value) {
+    if (!involves(var)) return;
+    restorePivots();
+    const int c = varToCol[var];
+    const uint64_t bit = 1ULL << (c & 63);
+    if (!(unassignedMask[c >> 6] & bit)) return;
+    unassignedMask[c >> 6] &= ~bit;
+    if (value) trueMask[c >> 6] |= bit;
+
+    // Alle Zeilen mit dieser Spalte müssen geprüft werden
+    for (int r = 0; r < static_cast<int>(rows.size()); ++r) {
+        if (testBit(rows[r], c)) touch(r);
+    }
+
+    // Belegte Pivot-Spalte → neues Pivot in derselben Zeile suchen
+    const int r = colPivotRow[c];
+    if (r != -1) {
+        colPivotRow[c] = -1;
+        pivot[r] = -1;
+        const int nc = findUnassignedCol(r, c);
+        if (nc != -1) makePivot(r, nc);
+    }
+}
+
+void XorEngine::unassign(int var) {
+    if (!involves(var)) return;
+    const int c = varToCol[var];
+    const uint64_t bit = 1ULL << (c & 63);
+    if (unassignedMask[c >> 6] & bit) return;
+    unassignedMask[c >> 6] |= bit;
+    trueMask[c >> 6] &= ~bit;
+
+    // Pivotlose Zeilen mit dieser Spalte brauchen wieder ein Pivot
+    for (int r = 0; r < static_cast<int>(rows.size()); ++r) {
+        if (pivot[r] == -1 && testBit(rows[r], c)) pendingPivot.push_back(r);
+    }
+}
+
+// Pivot-Invariante nach Backtrack wiederherstellen
+void XorEngine::restorePivots() {
+    for (int r : pendingPivot) {
+        if (pivot[r] != -1) continue;
+        const int c = findUnassignedCol(r, -1);
+        if (c != -1) makePivot(r, c);
+        touch(r);
+    }
+    pendingPivot.clear();
+}
+
+int XorEngine::propagate(std::vector<Implication>& out) {
+    restorePivots();
+
+    const size_t firstOut = out.size();
+    int conflict = -1;
+    size_t i = 0;
+    for (; i < touchedList.size() && conflict == -1; ++i) {
+        const int r = touchedList[i];
+        touched[r] = false;
+
+        int unassigned = 0;
+        int parity = 0;
+        for (size_t w = 0; w < words; ++w) {
+            unassigned += std::popcount(rows[r][w] & unassignedMask[w]);
+            parity     += std::popcount(rows[r][w] & trueMask[w]);
+        }
+        parity &= 1;
+
+        if (unassigned == 0) {
+            if (parity != rhs[r]) conflict = r;
+        } else if (unassigned == 1) {
+            const int c = findUnassignedCol(r, -1);
+            out.push_back({r, colToVar[c], (rhs[r] ^ parity) != 0});
+        }
+    }
+    // Nicht geprüfte Zeilen bleiben vorgemerkt
+    touchedList.erase(touchedList.begin(), touchedList.begin() + static_cast<std::ptrdiff_t>(i));
+
+    // Bei Konflikt werden die Implikationen verworfen → Zeilen später erneut prüfen
+    if (conflict != -1) {
+        for (size_t k = firstOut; k < out.size(); ++k) touch(out[k].row);
+        out.resize(firstOut);
+    }
+    return conflict;
+}
+
+std::vector<Literal> XorEngine::explain(const std::vector<uint64_t>& row, int impliedVar,
+                                        const std::vector<int>& assignment) const {
+    std::vector<Literal> lits;
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t bits = row[w];
+        while (bits) {
+            const int c = static_cast<int>(w * 64) + std::countr_zero(bits);
+            bits &= bits - 1;
+            const int v = colToVar[c];
+            const bool isTrue = (assignment[v] == 1);
+            // implizierte Variable: wahres Literal; alle anderen: aktuell falsches Literal
+            lits.emplace_back(v, v == impliedVar ? !isTrue : isTrue);
+        }
+    }
+    // implizierte Variable vorne (wie bei Reason-Klauseln üblich)
+    if (impliedVar != 0) {
+        auto it = std::find_if(lits.begin(), lits.end(), [&](const Literal& l) { return l.getVar() == impliedVar; });
+        if (it != lits.end()) std::iter_swap(lits.begin(), it);
+    }
+    return lits;
+}
@@ -0,0 +1,84 @@
+
+#ifndef XORENGINE_H
+#define XORENGINE_H
+
+#include <cstdint>
+#include <vector>
+#include "Clause.h"
+#include "Literal.h"
+
+// Gauß-Elimination für XOR-Constraints, die in der CNF als Klauselgruppen kodiert sind.
+// Die Matrix ist bitgepackt (eine Spalte pro beteiligter Variable) und wird in reduzierter
+// Stufenform gehalten: jede Zeile mit Pivot hat eine unbelegte Pivot-Spalte, die in keiner
+// anderen Zeile vorkommt. Zeilen ohne Pivot enthalten nur belegte Variablen.
+// Damit genügt es, einzelne Zeilen zu prüfen:
+//  - eine unbelegte Variable  → Implikation
+//  - keine unbelegte Variable → Konflikt, falls die Parität nicht stimmt
+class XorEngine {
+public:
+    // x_1 ⊕ ... ⊕ x_k = rhs
+    struct Xor {
+        std::vector<int> vars;
+        bool             rhs;
+    };
+
+    // Implikation aus einer Zeile: var := value
+    struct Implication {
+        int  row;
+        int  var;
+        bool value;
+    };
+
+    // XORs finden: alle 2^(k-1) Vorzeichenmuster gleicher Parität über denselben k Variablen
+    static std::vector<Xor> detect(const std::vector<Clause>& clauses, int maxSize = 6);
+
+    // Matrix aufbauen (alle Variablen unbelegt) und vollständig eliminieren
+    void init(const std::vector<Xor>& xors, int numVars);
+
+    bool   active()  const { return !rows.empty(); }
+    size_t numRows() const { return rows.size(); }
+
+    // true, wenn die Variable in einer XOR-Zeile vorkommt
+    bool involves(int var) const { return var < static_cast<int>(varToCol.size()) && varToCol[var] != -1; }
+
+    // Zuweisung/Rücknahme einer Variable (inkrementelle Pivot-Pflege)
+    void assign(int var, bool value);
+    void unassign(int var);
+
+    // Berührte Zeilen prüfen. Rückgabe: Index einer Konfliktzeile oder -1.
+    // Gefundene Implikationen werden an 'out' angehängt (bei Konflikt keine).
+    int propagate(std::vector<Implication>& out);
+
+    // Aktueller Inhalt einer Zeile (Kopie dient als Erklärung für lazy Reasons)
+    const std::vector<uint64_t>& row(int r) const { return rows[r]; }
+
+    // Klausel zu einer (gesicherten) Zeile: alle belegten Variablen als falsche Literale,
+    // impliedVar (falls != 0) als wahres Literal gemäß aktueller Belegung
+    std::vector<Literal> explain(const std::vector<uint64_t>& row, int impliedVar,
+                                 const std::vector<int>& assignment) const;
+
+private:
+    size_t words = 0;                       // 64-Bit-Wörter pro Zeile
+    std::vector<std::vector<uint64_t>> rows; // Koeffizienten (Linearkombinationen der Eingabe-XORs)
+    std::vector<uint8_t> rhs;               // rechte Seiten
+    std::vector<int>     pivot;             // Pivot-Spalte je Zeile (-1 = keine)
+    std::vector<int>     colPivotRow;       // Zeile je Pivot-Spalte (-1 = keine)
+
+    std::vector<int>      varToCol;         // Variable → Spalte (-1 = nicht beteiligt)
+    std::vector<int>      colToVar;         // Spalte → Variable
+    std::vector<uint64_t> unassignedMask;   // Bit gesetzt = Spalte unbelegt
+    std::vector<uint64_t> trueMask;         // Bit gesetzt = Spalte wahr belegt
+
+    std::vector<bool> touched;              // Zeile seit der letzten Prüfung verändert/betroffen
+    std::vector<int>  touchedList;
+    std::vector<int>  pendingPivot;         // Zeilen ohne Pivot, die nach Backtrack unbelegte Spalten haben
+
+    static bool testBit(const std::vector<uint64_t>& v, int col) { return (v[col >> 6] >> (col & 63)) & 1ULL; }
+
+    void touch(int r);
+    int  findUnassignedCol(int r, int exclude) const;
+    void makePivot(int r, int col);
+    void restorePivots();
+};
+
+#endif // XORENGINE_H
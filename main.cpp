@@ -6,12 +6,32 @@
 #include <cstring>   // std::strncmp, std::strlen
 #include <cctype>    // std::tolower
 #include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 #include "Literal.h"
 #include "Clause.h"
 #include "Trail.h"
 #include "CNFParser.h"
 #include "Solver.h"
+#include "Subsumption.h"
+#include "BlockedClauseElimination.h"
+#include "AtMostOne.h"
+#include "Symmetry.h"
+#include "Components.h"
+#include "ClauseExchange.h"
+#include "Cuber.h"
+#include "CubeAndConquer.h"
+#include "Distributed.h"
+#include "IncrementalSolver.h"
+#include "Backbone.h"
+#include "UnsatCore.h"
+#include "ProofWriter.h"
+#include "Reconstruction.h"
 
 // ------------------------------------------------------------
 // Hilfsfunktionen für CLI
@@ -84,6 +104,27 @@ static const char* heuristicName(HeuristicType h) {
     return "UNKNOWN";
 }
 
+static std::optional<RestartPolicy> restartFromString(std::string v) {
+    for (auto& c : v) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (v == "luby") {
+        return RestartPolicy::LUBY;
+    }
+    if (v == "geometric" || v == "geo") {
+        return RestartPolicy::GEOMETRIC;
+    }
+    return std::nullopt;
+}
+
+static const char* restartName(RestartPolicy r) {
+    switch (r) {
+        case RestartPolicy::LUBY:      return "LUBY";
+        case RestartPolicy::GEOMETRIC: return "GEOMETRIC";
+    }
+    return "UNKNOWN";
+}
+
 // Sammelt alle Heuristiken aus den CLI-Argumenten.
 // Akzeptiert:
 //   --heuristic=vsids
@@ -141,6 +182,306 @@ static std::vector<HeuristicType> collectHeuristicsFromCLI(int argc, char** argv
     return hs;
 }
 
+// ------------------------------------------------------------
+// Ausgabe
+// ------------------------------------------------------------
+
+static void printModel(const std::vector<int>& model) {
+    for (size_t i = 1; i < model.size(); ++i) {
+        std::cout << "x" << i << " = "
+        << (model[i] == -1 ? "Unassigned"
+            : (model[i] == 1 ? "True" : "False")) << "\n";
+    }
+}
+
+// Laufzeit + einheitliche RESULT-Zeile eines Runs
+static void printRunSummary(HeuristicType h, uint64_t seed, const std::string& cnfPath, bool sat,
+                            std::chrono::high_resolution_clock::duration elapsed) {
+    auto dt_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+    auto dt_s   = std::chrono::duration_cast<std::chrono::seconds>(elapsed);
+    auto dt_min = std::chrono::duration_cast<std::chrono::minutes>(elapsed);
+
+    // Kompakte Zusammenfassung / gut für Parser (optional erweiterbar)
+    std::cout << std::string(20, '-') << "\n";
+    std::cout << "Laufzeit (" << heuristicName(h) << "):\n"
+              << " - " << dt_ms.count()  << " ms\n"
+              << " - " << dt_s.count()   << " seconds\n"
+              << " - " << dt_min.count() << " minutes\n";
+
+    // Einheitliche RESULT-Zeile (praktisch für CSV-Parser)
+    // time_s = bei UNSAT/SAT reale Zeit in Sekunden
+    std::cout << "RESULT,heuristic=" << heuristicName(h)
+              << ",seed=" << seed
+              << ",instance=" << cnfPath
+              << ",solved=" << (sat ? 1 : 0)
+              << ",time_s=" << dt_s.count()
+              << std::endl;
+}
+
+// ------------------------------------------------------------
+// Komponenten-Modus
+// ------------------------------------------------------------
+
+// Löst alle Komponenten mit je einem eigenen Solver auf einem Worker-Pool.
+// Sobald eine Komponente UNSAT ist, werden die übrigen über das Stop-Flag abgebrochen.
+// Bei SAT enthält 'model' die zusammengesetzte globale Belegung; 'summary' sammelt die
+// aufsummierten Statistiken aller Komponenten-Solver.
+static bool solveComponents(const ComponentSplitter::Result& split, HeuristicType h, uint64_t seed,
+                            RestartPolicy restart, const Reconstruction& bceStack, Solver& summary,
+                            std::vector<int>& model) {
+    if (split.unsat) return false;
+
+    model = split.fixed;
+    const auto& comps = split.components;
+    std::atomic<bool>   stop{false};
+    std::atomic<size_t> next{0};
+    std::mutex          mtx; // schützt model, summary + Ausgabe
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < comps.size() && !stop.load(std::memory_order_relaxed); i = next++) {
+            const auto& comp = comps[i];
+            Solver solver{static_cast<int>(comp.vars.size())};
+            solver.setHeuristic(h);
+            if (seed != 0) {
+                solver.setHeuristicSeed(seed + i);
+            }
+            solver.setRestartPolicy(restart);
+            solver.setVerbose(false);
+            solver.setStopFlag(&stop);
+            for (const auto& lits : comp.amos) {
+                solver.addAtMostOne(lits);
+            }
+            solver.loadClauses(std::vector<Clause>(comp.clauses));
+            const bool sat = solver.solve();
+
+            std::lock_guard<std::mutex> lock(mtx);
+            summary.addStats(solver);
+            std::cout << "Komponente " << i << ": " << comp.vars.size() << " Variablen, "
+                      << comp.clauses.size() << " Klauseln -> "
+                      << (solver.isInterrupted() ? "abgebrochen" : (sat ? "SAT" : "UNSAT")) << "\n";
+            if (solver.isInterrupted()) continue;
+            if (!sat) {
+                stop = true;
+                continue;
+            }
+            const std::vector<int> local = solver.getModel();
+            for (size_t v = 0; v < comp.vars.size(); ++v) {
+                model[comp.vars[v]] = local[v + 1];
+            }
+        }
+    };
+
+    const size_t numWorkers = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), comps.size());
+    std::vector<std::thread> pool;
+    for (size_t w = 1; w < numWorkers; ++w) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) {
+        t.join();
+    }
+    if (stop) return false;
+
+    // Variablen ohne Klauseln beliebig belegen, danach BCE-Reparatur
+    for (size_t v = 1; v < model.size(); ++v) {
+        if (model[v] == -1) model[v] = 0;
+    }
+    bceStack.extend(model);
+    return true;
+}
+
+// ------------------------------------------------------------
+// Portfolio-Modus
+// ------------------------------------------------------------
+
+struct PortfolioConfig {
+    HeuristicType heuristic;
+    RestartPolicy restart;
+    uint64_t      seed;
+};
+
+// n Konfigurationen: Heuristiken zyklisch, dann abwechselnd Luby/geometrisch, Seeds fortlaufend
+static std::vector<PortfolioConfig> portfolioConfigs(const std::vector<HeuristicType>& hs, uint64_t baseSeed, size_t n) {
+    std::vector<PortfolioConfig> configs;
+    for (size_t k = 0; k < n; ++k) {
+        configs.push_back({hs[k % hs.size()],
+                           (k / hs.size()) % 2 == 0 ? RestartPolicy::LUBY : RestartPolicy::GEOMETRIC,
+                           (baseSeed != 0 ? baseSeed : 1) + k});
+    }
+    return configs;
+}
+
+// Alle Solver parallel starten; der erste, der fertig wird, stoppt die übrigen über das
+// gemeinsame Stop-Flag. Rückgabe: Index des Gewinners (-1 = keiner), 'sat' = dessen Ergebnis
+static int solvePortfolio(std::vector<std::unique_ptr<Solver>>& solvers, bool& sat) {
+    std::atomic<bool> stop{false};
+    std::atomic<int>  winner{-1};
+    std::vector<char> results(solvers.size(), 0);
+
+    auto run = [&](size_t k) {
+        const bool res = solvers[k]->solve();
+        if (solvers[k]->isInterrupted()) return;
+        int none = -1;
+        if (winner.compare_exchange_strong(none, static_cast<int>(k))) {
+            results[k] = res;
+            stop = true;
+        }
+    };
+
+    for (auto& s : solvers) {
+        s->setStopFlag(&stop);
+    }
+    std::vector<std::thread> pool;
+    for (size_t k = 1; k < solvers.size(); ++k) {
+        pool.emplace_back(run, k);
+    }
+    run(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+
+    const int w = winner.load();
+    sat = w >= 0 && results[w] != 0;
+    return w;
+}
+
+// ------------------------------------------------------------
+// Inkrementeller Modus (iCNF)
+// ------------------------------------------------------------
+
+// iCNF abarbeiten: Klauseln kommen zum Solver hinzu, jede "a ... 0"-Zeile ist eine Anfrage
+// unter diesen Annahmen. Ohne a-Zeilen wird am Ende einmal ohne Annahmen gelöst.
+static int runIncremental(const std::string& path, HeuristicType h, uint64_t seed, const std::string& statsCsvFile) {
+    std::ifstream in{path};
+    if (!in.is_open()) {
+        std::cerr << "Fehler: Konnte iCNF nicht lesen: " << path << std::endl;
+        return 1;
+    }
+
+    IncrementalSolver inc{h};
+    if (seed != 0) inc.get().setHeuristicSeed(seed);
+    std::cout << "Inkrementell: " << path << "\n";
+
+    auto t_start = std::chrono::high_resolution_clock::now();
+    size_t queries = 0, satCount = 0;
+    int last = IncrementalSolver::UNKNOWN;
+    std::string tok;
+    std::vector<int> assumed;
+    // Einlesen und Anfragen wechseln sich ab: als Einlesezeit zählt alles außerhalb von solve()
+    std::chrono::steady_clock::duration solveTime{0};
+    auto timedSolve = [&] {
+        const auto t0 = std::chrono::steady_clock::now();
+        const int r = inc.solve();
+        solveTime += std::chrono::steady_clock::now() - t0;
+        return r;
+    };
+    try {
+        while (in >> tok) {
+            if (tok == "c" || tok == "p") {
+                std::getline(in, tok);
+                continue;
+            }
+            if (tok != "a") {
+                inc.add(std::stoi(tok));
+                continue;
+            }
+
+            assumed.clear();
+            while (in >> tok && tok != "0") assumed.push_back(std::stoi(tok));
+            for (int a : assumed) inc.assume(a);
+            last = timedSolve();
+            ++queries;
+            const size_t failed = static_cast<size_t>(std::ranges::count_if(assumed, [&](int a) { return inc.failed(a); }));
+            if (last == IncrementalSolver::SAT) ++satCount;
+            std::cout << "Anfrage " << queries << ": "
+                      << (last == IncrementalSolver::SAT ? "SATISFIABLE" : "UNSATISFIABLE");
+            if (last == IncrementalSolver::UNSAT && !assumed.empty()) {
+                std::cout << " (" << failed << " von " << assumed.size() << " Annahmen beteiligt)";
+            }
+            std::cout << "\n";
+        }
+    } catch (...) {
+        std::cerr << "Fehler: Ungültiges Token in iCNF: " << tok << std::endl;
+        return 1;
+    }
+
+    if (queries == 0) {
+        last = timedSolve();
+        std::cout << (last == IncrementalSolver::SAT ? "SATISFIABLE" : "UNSATISFIABLE") << "\n";
+        if (last == IncrementalSolver::SAT) inc.get().printModel();
+    } else {
+        std::cout << "Anfragen: " << queries << " (" << satCount << " SAT, " << queries - satCount << " UNSAT)\n";
+    }
+    auto t_end = std::chrono::high_resolution_clock::now();
+
+    const auto parseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start - solveTime);
+    inc.get().setParseTime(static_cast<uint64_t>(std::max<int64_t>(parseTime.count(), 0)));
+    inc.get().printStats();
+    printRunSummary(h, seed, path, last == IncrementalSolver::SAT, t_end - t_start);
+    inc.get().exportStats(statsCsvFile);
+    return 0;
+}
+
+// ------------------------------------------------------------
+// Modellaufzählung
+// ------------------------------------------------------------
+
+// Variablenliste "1,4,7-9" (Bereiche inklusive). nullopt bei ungültigen Einträgen
+static std::optional<std::vector<int>> parseVarList(const std::string& s, int numVars) {
+    std::vector<int> vars;
+    try {
+        for (const auto& tok : splitCommaList(s)) {
+            const size_t dash = tok.find('-', 1);
+            const int lo = std::stoi(tok.substr(0, dash));
+            const int hi = dash == std::string::npos ? lo : std::stoi(tok.substr(dash + 1));
+            if (lo < 1 || hi > numVars || lo > hi) return std::nullopt;
+            for (int v = lo; v <= hi; ++v) vars.push_back(v);
+        }
+    } catch (...) {
+        return std::nullopt;
+    }
+    std::ranges::sort(vars);
+    vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+    return vars;
+}
+
+// Modelle nacheinander auf einem Solver aufzählen: jedes Modell wird sofort ausgegeben
+// (nur die Projektionsvariablen, leer = alle) und per Blockklausel ausgeschlossen.
+// limit = 0: alle Modelle. Rückgabe: Anzahl gefundener Modelle
+static uint64_t enumerateModels(Solver& solver, uint64_t limit, const std::vector<int>& projection,
+                                bool& complete) {
+    uint64_t count = 0;
+    complete = false;
+    while (limit == 0 || count < limit) {
+        if (!solver.solve()) {
+            complete = !solver.isInterrupted();
+            break;
+        }
+        ++count;
+        const std::vector<int> model = solver.getModel();
+        std::cout << "Modell " << count << ":";
+        auto printLit = [&](int v) { std::cout << ' ' << (model[v] == 1 ? v : -v); };
+        if (projection.empty()) {
+            for (size_t v = 1; v < model.size(); ++v) printLit(static_cast<int>(v));
+        } else {
+            for (int v : projection) printLit(v);
+        }
+        std::cout << std::endl;
+        if (!solver.blockModel(projection)) {
+            complete = true;
+            break;
+        }
+    }
+    return count;
+}
+
+// Tiefe des Lookahead-Baums: etwa 16 Cubes je Worker
+static int autoCubeDepth(size_t workers) {
+    int depth = 4;
+    while ((size_t{1} << (depth - 4)) < workers && depth < 20) ++depth;
+    return depth;
+}
+
 // ------------------------------------------------------------
 
 int main(int argc, char** argv) {
@@ -184,16 +525,171 @@ int main(int argc, char** argv) {
         }
     }
 
+    // --bce: Blocked Clause Elimination vor dem Lösen
+    const bool useBCE = getArgValue(argc, argv, "--bce").has_value();
+
+    // --parse-threads=N: Threads für das Einlesen großer CNF-Dateien (0 = automatisch)
+    unsigned parseThreads = 0;
+    if (auto s = getArgValue(argc, argv, "--parse-threads")) {
+        try {
+            parseThreads = static_cast<unsigned>(std::stoul(*s));
+        } catch (...) {
+            parseThreads = 0;
+        }
+    }
+
+    // --cache=DIR: Binär-Cache für geparste Formeln (Schlüssel = Inhalts-Hash)
+    std::string cacheDir;
+    if (auto s = getArgValue(argc, argv, "--cache")) {
+        cacheDir = *s;
+    }
+
+    // --restart=luby|geometric: Restart-Strategie
+    RestartPolicy restart = RestartPolicy::LUBY;
+    if (auto s = getArgValue(argc, argv, "--restart")) {
+        if (auto r = restartFromString(*s)) {
+            restart = *r;
+        } else {
+            std::cerr << "Fehler: Unbekannte Restart-Strategie \"" << *s << "\".\n";
+            return 1;
+        }
+    }
+
+    // --portfolio[=N]: N Solver-Konfigurationen (Heuristik × Restart × Seed) parallel,
+    // der erste fertige gewinnt (ohne N: Anzahl Hardware-Threads, mindestens #Heuristiken)
+    const auto portfolioArg = getArgValue(argc, argv, "--portfolio");
+    size_t portfolioSize = 0;
+    if (portfolioArg && !portfolioArg->empty()) {
+        try {
+            portfolioSize = std::stoul(*portfolioArg);
+        } catch (...) {
+            portfolioSize = 0;
+        }
+    }
+
+    // --share: Portfolio-Worker tauschen kurze gelernte Klauseln aus (impliziert --portfolio)
+    const bool useSharing = getArgValue(argc, argv, "--share").has_value();
+
+    // --cnc[=N]: Cube-and-Conquer mit N Workern (ohne N: Anzahl Hardware-Threads)
+    const auto cncArg = getArgValue(argc, argv, "--cnc");
+    size_t cncWorkers = 0;
+    if (cncArg && !cncArg->empty()) {
+        try {
+            cncWorkers = std::stoul(*cncArg);
+        } catch (...) {
+            cncWorkers = 0;
+        }
+    }
+
+    // --cube-depth=D: Tiefe des Lookahead-Baums (0 = automatisch aus der Anzahl Worker)
+    int cubeDepth = 0;
+    if (auto s = getArgValue(argc, argv, "--cube-depth")) {
+        try {
+            cubeDepth = std::stoi(*s);
+        } catch (...) {
+            cubeDepth = 0;
+        }
+    }
+
+    // --icnf=PATH: Cubes + Formel im iCNF-Format schreiben und beenden
+    std::string icnfFile;
+    if (auto s = getArgValue(argc, argv, "--icnf")) {
+        icnfFile = *s;
+    }
+
+    // --distributed=N: N Worker-Prozesse über Unix-Sockets (Portfolio, mit --cnc Cubes)
+    const auto distArg = getArgValue(argc, argv, "--distributed");
+    size_t distWorkers = 0;
+    if (distArg && !distArg->empty()) {
+        try {
+            distWorkers = std::stoul(*distArg);
+        } catch (...) {
+            distWorkers = 0;
+        }
+    }
+
+    // --models[=N]: bis zu N Modelle aufzählen (ohne N bzw. 0: alle), --project=LIST schränkt
+    // Ausgabe und Blockklauseln auf diese Variablen ein (z. B. 1,2,10-20)
+    const auto modelsArg = getArgValue(argc, argv, "--models");
+    uint64_t modelLimit = 0;
+    if (modelsArg && !modelsArg->empty()) {
+        try {
+            modelLimit = std::stoull(*modelsArg);
+        } catch (...) {
+            modelLimit = 0;
+        }
+    }
+    const auto projectArg = getArgValue(argc, argv, "--project");
+
+    // --backbone: Literale bestimmen, die in jedem Modell wahr sind
+    const bool useBackbone = getArgValue(argc, argv, "--backbone").has_value();
+
+    // Beide Modi brauchen die unveränderte Modellmenge
+    const bool keepModels = modelsArg || useBackbone;
+
+    // --core[=FILE]: UNSAT-Kern über Selektoren bestimmen (optional als DIMACS nach FILE),
+    // --trim-core=SEC verkleinert ihn höchstens SEC Sekunden lang (Ziel: minimaler Kern)
+    const auto coreArg = getArgValue(argc, argv, "--core");
+    double coreTrimSeconds = 0;
+    if (auto s = getArgValue(argc, argv, "--trim-core")) {
+        try {
+            coreTrimSeconds = std::stod(*s);
+        } catch (...) {
+            coreTrimSeconds = 0;
+        }
+    }
+    // Der Kern bezieht sich auf die Eingabeklauseln: keine Vorverarbeitung, die sie verändert
+    const bool keepClauses = coreArg.has_value();
+
+    // --components: variablendisjunkte Komponenten getrennt (parallel) lösen
+    const bool useComponents = getArgValue(argc, argv, "--components").has_value();
+
+    // --symmetry: Symmetrieerkennung + Lex-Leader-Klauseln vor dem Lösen
+    const bool useSymmetry = getArgValue(argc, argv, "--symmetry").has_value();
+
+    // --proof=PATH: DRAT-Beweis (binär) für UNSAT-Ergebnisse, --async-proof schreibt ihn
+    // auf einem Hintergrund-Thread
+    std::string proofFile;
+    if (auto s = getArgValue(argc, argv, "--proof")) {
+        proofFile = *s;
+    }
+    const bool asyncProof = getArgValue(argc, argv, "--async-proof").has_value();
+
     // Mehrere Heuristiken einsammeln
     std::vector<HeuristicType> heuristics = collectHeuristicsFromCLI(argc, argv);
 
+    // Beweise nur für einen einzelnen sequentiellen Solver (die anderen Modi teilen Klauseln,
+    // lösen Teilformeln oder fügen nicht ableitbare Klauseln hinzu)
+    if (!proofFile.empty() && (portfolioArg || useSharing || cncArg || distArg || useComponents
+                               || modelsArg || useBackbone || coreArg || getArgValue(argc, argv, "--incremental"))) {
+        std::cerr << "Fehler: --proof ist nur im sequentiellen Modus möglich.\n";
+        return 1;
+    }
+    if (!proofFile.empty() && useSymmetry) {
+        std::cout << "Hinweis: --symmetry wird bei --proof ignoriert\n";
+    }
+
+    // --components verteilt selbst auf Threads: nicht mit den parallelen Modi kombinierbar
+    if (useComponents && (portfolioArg || useSharing || cncArg || !icnfFile.empty() || distArg)) {
+        std::cerr << "Fehler: --components ist nicht mit --portfolio, --share, --cnc, --icnf "
+                     "oder --distributed kombinierbar.\n";
+        return 1;
+    }
+
+    // --incremental: --cnf als iCNF lesen und die Anfragen auf einem Solver nacheinander lösen
+    if (getArgValue(argc, argv, "--incremental")) {
+        return runIncremental(cnfPath, heuristics.front(), seed, statsCsvFile);
+    }
+
 
     // Parser anlegen + Einlesezeit messen
     std::cout << "Arbeitsverzeichnis: " << std::filesystem::current_path() << "\n";
     std::cout << "CNF-Pfad (übergeben): " << cnfPath << "\n";
     std::error_code _fs_ec;
     auto _abs = std::filesystem::weakly_canonical(std::filesystem::path(cnfPath), _fs_ec);
-    if (!_fs_ec) {
+    if (cnfPath == "-") {
+        std::cout << "CNF-Eingabe: stdin\n";
+    } else if (!_fs_ec) {
         std::cout << "CNF-Pfad (aufgelöst): " << _abs << "\n";
         cnfPath = _abs.string();
     } else {
@@ -206,6 +702,10 @@ int main(int argc, char** argv) {
 
 
     CNFParser parser{cnfPath};
+    parser.setNumThreads(parseThreads);
+    if (!cacheDir.empty()) {
+        parser.setCacheDir(cacheDir);
+    }
     auto t_read_start = std::chrono::high_resolution_clock::now();
 
     if (!parser.readFile()) {
@@ -216,11 +716,396 @@ int main(int argc, char** argv) {
     auto t_read_end = std::chrono::high_resolution_clock::now();
     auto read_seconds = std::chrono::duration_cast<std::chrono::seconds>(t_read_end - t_read_start);
     std::cout << "Einlesen: " << read_seconds.count() << " Sekunden\n";
+    // Für das Laufzeitprofil der Solver (Anteil des Einlesens an der Gesamtzeit)
+    const auto parseNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t_read_end - t_read_start).count());
+
+    // Subsumption + Self-Subsuming Resolution einmalig auf der Eingabe
+    // (nicht mit Beweis: die verkürzten Klauseln würden im DRAT fehlen)
+    if (proofFile.empty() && !keepClauses) {
+        const Subsumption subsumption;
+        const auto res = subsumption.simplify(parser.getClauses(), parser.getNumVariables());
+        std::cout << "Subsumption: " << res.removedCount << " Klauseln entfernt, "
+                  << res.strengthenedCount << " Literale entfernt\n";
+    }
+
+    // Optional: Symmetry Breaking (auf der vollständigen Klauselmenge, vor BCE/AMO)
+    // (nicht bei Modellaufzählung/Backbone: Symmetriebrechung und BCE verändern die Modellmenge)
+    if (useSymmetry && !keepModels && !keepClauses && proofFile.empty()) {
+        const SymmetryBreaker breaker;
+        const auto res = breaker.run(parser.getClauses(), parser.getNumVariables());
+        std::cout << "Symmetrie: " << res.generators << " Generatoren, " << res.addedClauses
+                  << " Klauseln hinzugefügt" << (res.complete ? "" : " (Budget erschöpft)") << "\n";
+    }
+
+    // Optional: Blocked Clause Elimination (entfernte Klauseln für die Modell-Reparatur merken)
+    Reconstruction bceStack;
+    if (useBCE && !keepModels && !keepClauses) {
+        const BlockedClauseElimination bce;
+        const size_t removed = bce.eliminate(parser.getClauses(), parser.getNumVariables(), bceStack);
+        std::cout << "BCE: " << removed << " blockierte Klauseln entfernt\n";
+    }
+
+    // At-Most-One-Cliquen erkennen (nach BCE: dort müssen die Binärklauseln noch sichtbar sein)
+    AtMostOneDetector::Result amo;
+    if (!keepClauses) {
+        const AtMostOneDetector detector;
+        amo = detector.extract(parser.getClauses(), parser.getNumVariables());
+        std::cout << "AMO: " << amo.constraints.size() << " Constraints (" << amo.exactlyOne
+                  << " Exactly-One), " << amo.removedBinaries << " Binärklauseln ersetzt\n";
+    }
 
-    // Klauseln/Variablen aus Parser übernehmen
-    const auto clauses = parser.getClauses();
+    // Klauseln/Variablen aus Parser übernehmen (ohne Kopie; der letzte Run übernimmt den Puffer)
+    auto& clauses = parser.getClauses();
     const int numVars  = parser.getNumVariables();
 
+    // UNSAT-Kern auf einem Solver (hat Vorrang vor den parallelen Modi)
+    if (coreArg) {
+        if (useSymmetry || useBCE) {
+            std::cout << "Hinweis: --symmetry/--bce werden bei --core ignoriert\n";
+        }
+
+        const HeuristicType h = heuristics.front();
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(h) << "\n";
+
+        Solver solver{numVars};
+        solver.setHeuristic(h);
+        if (seed != 0) {
+            solver.setHeuristicSeed(seed);
+        }
+        solver.setRestartPolicy(restart);
+        solver.setParseTime(parseNs);
+        solver.setVerbose(false);
+
+        std::cout << "Solving...\n";
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        UnsatCore::Options opts;
+        opts.trimSeconds = coreTrimSeconds;
+        const UnsatCore extractor{opts};
+        const UnsatCore::Result res = extractor.extract(solver, numVars, clauses);
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+        if (res.unsat) {
+            std::cout << "UNSATISFIABLE\n";
+            std::cout << "Kern: " << res.groups.size() << " von " << clauses.size() << " Klauseln (erster Kern "
+                      << res.initialSize << ", " << res.solves << " Aufrufe"
+                      << (res.minimal ? ", minimal" : "") << ")\n";
+            std::cout << "c core";
+            for (size_t i : res.groups) std::cout << ' ' << i + 1;
+            std::cout << " 0\n";
+            if (!coreArg->empty()) {
+                if (!UnsatCore::writeDimacs(*coreArg, numVars, clauses, {}, res)) {
+                    std::cerr << "Fehler: Konnte Kern nicht schreiben: " << *coreArg << "\n";
+                    return 1;
+                }
+                std::cout << "Kern geschrieben: " << *coreArg << "\n";
+            }
+        } else if (solver.isInterrupted()) {
+            std::cout << "UNKNOWN\n";
+        } else {
+            std::cout << "SATISFIABLE\n";
+        }
+        solver.printStats();
+        printRunSummary(h, seed, cnfPath, !res.unsat, t_solve_end - t_solve_start);
+        solver.exportStats(statsCsvFile);
+        return 0;
+    }
+
+    // Backbone auf einem warm gehaltenen Solver (hat Vorrang vor den parallelen Modi)
+    if (useBackbone) {
+        if (useSymmetry || useBCE) {
+            std::cout << "Hinweis: --symmetry/--bce werden bei --backbone ignoriert\n";
+        }
+
+        const HeuristicType h = heuristics.front();
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(h) << "\n";
+
+        Solver solver{numVars};
+        solver.setHeuristic(h);
+        if (seed != 0) {
+            solver.setHeuristicSeed(seed);
+        }
+        solver.setRestartPolicy(restart);
+        solver.setParseTime(parseNs);
+        solver.setVerbose(false);
+        for (const auto& lits : amo.constraints) {
+            solver.addAtMostOne(lits);
+        }
+        solver.loadClauses(std::move(clauses));
+
+        std::cout << "Solving...\n";
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        const Backbone backbone;
+        const Backbone::Result res = backbone.compute(solver, numVars);
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+        if (res.sat) {
+            std::cout << "SATISFIABLE\n";
+            std::cout << "Backbone: " << res.literals.size() << " von " << numVars << " Variablen ("
+                      << res.solves << " Aufrufe, " << res.chunks << " Blöcke bestätigt, "
+                      << res.filtered << " Kandidaten durch Modelle gestrichen)\n";
+            std::cout << "b";
+            for (const auto& l : res.literals) std::cout << ' ' << l.toInt();
+            std::cout << " 0\n";
+        } else {
+            std::cout << "UNSATISFIABLE\n";
+        }
+        solver.printStats();
+        printRunSummary(h, seed, cnfPath, res.sat, t_solve_end - t_solve_start);
+        solver.exportStats(statsCsvFile);
+        return 0;
+    }
+
+    // Modellaufzählung auf einem Solver (hat Vorrang vor den parallelen Modi)
+    if (modelsArg) {
+        std::vector<int> projection;
+        if (projectArg) {
+            auto vars = parseVarList(*projectArg, numVars);
+            if (!vars) {
+                std::cerr << "Fehler: Ungültige Projektion \"" << *projectArg << "\".\n";
+                return 1;
+            }
+            projection = std::move(*vars);
+        }
+        if (useSymmetry || useBCE) {
+            std::cout << "Hinweis: --symmetry/--bce werden bei --models ignoriert\n";
+        }
+
+        const HeuristicType h = heuristics.front();
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(h) << "\n";
+        std::cout << "Modellaufzählung: " << (modelLimit == 0 ? std::string("alle") : std::to_string(modelLimit))
+                  << " Modelle, Projektion: "
+                  << (projection.empty() ? std::string("alle") : std::to_string(projection.size()))
+                  << " Variablen\n";
+
+        Solver solver{numVars};
+        solver.setHeuristic(h);
+        if (seed != 0) {
+            solver.setHeuristicSeed(seed);
+        }
+        solver.setRestartPolicy(restart);
+        solver.setParseTime(parseNs);
+        solver.setVerbose(false);
+        for (const auto& lits : amo.constraints) {
+            solver.addAtMostOne(lits);
+        }
+        solver.loadClauses(std::move(clauses));
+
+        std::cout << "Solving...\n";
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        bool complete = false;
+        const uint64_t found = enumerateModels(solver, modelLimit, projection, complete);
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+        std::cout << (found > 0 ? "SATISFIABLE" : "UNSATISFIABLE") << "\n";
+        std::cout << "Modelle: " << found << (complete ? " (vollständig)" : " (Limit erreicht)") << "\n";
+        solver.printStats();
+        printRunSummary(h, seed, cnfPath, found > 0, t_solve_end - t_solve_start);
+        solver.exportStats(statsCsvFile);
+        return 0;
+    }
+
+    // Komponentenzerlegung einmalig für alle Heuristiken
+    ComponentSplitter::Result split;
+    if (useComponents) {
+        const ComponentSplitter splitter;
+        split = splitter.split(clauses, amo.constraints, numVars);
+        std::cout << "Komponenten: " << split.components.size()
+                  << (split.unsat ? " (Widerspruch auf Level 0)" : "") << "\n";
+    }
+
+    // Mehrere Prozesse: Formel im Shared Memory, Koordination über Sockets
+    if (distArg) {
+        const size_t n = distWorkers != 0
+                         ? distWorkers
+                         : std::max<size_t>(std::thread::hardware_concurrency(), heuristics.size());
+        std::cout << std::string(40, '-') << "\n";
+
+        std::vector<std::vector<Literal>> cubes;
+        std::vector<DistributedSolver::Job> jobs;
+        bool refutedByCuber = false;
+        if (cncArg) {
+            const int depth = cubeDepth > 0 ? cubeDepth : autoCubeDepth(n);
+            Cuber cuber{numVars, clauses, amo.constraints};
+            Cuber::Result r = cuber.cube(depth);
+            refutedByCuber = r.unsat;
+            cubes = std::move(r.cubes);
+            std::cout << "Cubes: " << cubes.size() << " (Tiefe " << depth << ")\n";
+            for (size_t k = 0; k < n; ++k) {
+                jobs.push_back({heuristics.front(), restart, (seed != 0 ? seed : 1) + k});
+            }
+        } else {
+            for (const auto& cfg : portfolioConfigs(heuristics, seed, n)) {
+                jobs.push_back({cfg.heuristic, cfg.restart, cfg.seed});
+            }
+        }
+        std::cout << "Verteilt: " << n << " Prozesse" << (useSharing ? " (Klauseltausch)" : "") << "\n";
+        std::cout << "Solving...\n";
+
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        DistributedSolver::Result res;
+        if (refutedByCuber) {
+            res.ok = true;
+        } else {
+            DistributedSolver dist{numVars, clauses, amo.constraints};
+            res = dist.run(jobs, cubes, useSharing);
+        }
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+        if (!res.ok) {
+            std::cerr << "Fehler: " << res.error << "\n";
+            return 1;
+        }
+
+        const DistributedSolver::Job& job = jobs[std::max(res.winner, 0)];
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(job.heuristic) << "\n";
+        std::cout << "Gewinner: Prozess " << res.winner << " (" << heuristicName(job.heuristic) << ", "
+                  << restartName(job.restart) << ", seed=" << job.seed << ")\n";
+        std::cout << "Weitergeleitete Klauseln: " << res.relayed << ", widerlegte Cubes: " << res.cubesRefuted << "\n";
+        if (res.sat) {
+            // BCE-Reparatur im Koordinator (die Worker kennen nur die vereinfachte Formel)
+            std::vector<int> model = res.model;
+            for (size_t v = 1; v < model.size(); ++v) {
+                if (model[v] == -1) model[v] = 0;
+            }
+            bceStack.extend(model);
+            std::cout << "SATISFIABLE\n";
+            printModel(model);
+        } else {
+            std::cout << "UNSATISFIABLE\n";
+        }
+        printRunSummary(job.heuristic, job.seed, cnfPath, res.sat, t_solve_end - t_solve_start);
+        return 0;
+    }
+
+    // Cube-and-Conquer: Lookahead-Cubes auf einem Pool von Solvern (bzw. nur als iCNF ausgeben)
+    if (cncArg || !icnfFile.empty()) {
+        const size_t n = std::max<size_t>(cncWorkers != 0 ? cncWorkers : std::thread::hardware_concurrency(), 1);
+        const int depth = cubeDepth > 0 ? cubeDepth : autoCubeDepth(n);
+
+        std::cout << std::string(40, '-') << "\n";
+        auto t_cube_start = std::chrono::high_resolution_clock::now();
+        Cuber cuber{numVars, clauses, amo.constraints};
+        const Cuber::Result cubes = cuber.cube(depth);
+        auto t_cube_end = std::chrono::high_resolution_clock::now();
+        std::cout << "Cubes: " << cubes.cubes.size() << " (Tiefe " << depth << ", "
+                  << cuber.lookaheads() << " Lookaheads, "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t_cube_end - t_cube_start).count()
+                  << " ms)\n";
+
+        if (!icnfFile.empty()) {
+            if (!Cuber::writeICNF(icnfFile, clauses, amo.constraints, cubes.cubes)) {
+                std::cerr << "Fehler: Konnte iCNF nicht schreiben: " << icnfFile << "\n";
+                return 1;
+            }
+            std::cout << "iCNF geschrieben: " << icnfFile << "\n";
+            return 0;
+        }
+
+        const HeuristicType h = heuristics.front();
+        std::cout << "Cube-and-Conquer: " << n << " Worker" << (useSharing ? " (Klauseltausch)" : "") << "\n";
+
+        ClauseExchange exchange{n};
+        std::vector<std::unique_ptr<Solver>> solvers;
+        for (size_t k = 0; k < n; ++k) {
+            auto s = std::make_unique<Solver>(numVars);
+            s->setHeuristic(h);
+            s->setHeuristicSeed((seed != 0 ? seed : 1) + k);
+            s->setRestartPolicy(restart);
+            s->setParseTime(parseNs);
+            s->setVerbose(false);
+            if (useSharing) {
+                s->setClauseExchange(&exchange, k);
+            }
+            s->addReconstruction(bceStack);
+            for (const auto& lits : amo.constraints) {
+                s->addAtMostOne(lits);
+            }
+            // Die Cuber der Worker lesen die Formel weiter, daher hier immer kopieren
+            s->loadClauses(std::vector<Clause>(clauses));
+            solvers.push_back(std::move(s));
+        }
+
+        std::cout << "Solving...\n";
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        CubeAndConquer cnc{numVars, clauses, amo.constraints, {}};
+        const CubeAndConquer::Result res = cnc.run(cubes.cubes, solvers);
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+        const int w = std::max(res.winner, 0);
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(h) << "\n";
+        std::cout << "Cubes gelöst: " << res.solvedCubes << ", geteilt: " << res.splits
+                  << ", gestohlen: " << res.steals << "\n";
+        if (res.sat) {
+            std::cout << "SATISFIABLE\n";
+            printModel(res.model);
+        } else {
+            std::cout << "UNSATISFIABLE\n";
+        }
+        solvers[w]->printStats();
+        printRunSummary(h, seed, cnfPath, res.sat, t_solve_end - t_solve_start);
+        solvers[w]->exportStats(statsCsvFile);
+        return 0;
+    }
+
+    // Portfolio: alle Konfigurationen gleichzeitig, nur der Gewinner wird ausgegeben
+    if (portfolioArg || useSharing) {
+        const size_t n = portfolioSize != 0
+                         ? portfolioSize
+                         : std::max<size_t>(std::thread::hardware_concurrency(), heuristics.size());
+        const auto configs = portfolioConfigs(heuristics, seed, n);
+        std::cout << std::string(40, '-') << "\n";
+        std::cout << "Portfolio: " << configs.size() << " Worker"
+                  << (useSharing ? " (Klauseltausch)" : "") << "\n";
+
+        ClauseExchange exchange{configs.size()};
+        std::vector<std::unique_ptr<Solver>> solvers;
+        for (size_t k = 0; k < configs.size(); ++k) {
+            auto s = std::make_unique<Solver>(numVars);
+            s->setHeuristic(configs[k].heuristic);
+            s->setHeuristicSeed(configs[k].seed);
+            s->setRestartPolicy(configs[k].restart);
+            s->setParseTime(parseNs);
+            s->setVerbose(false);
+            if (useSharing) {
+                s->setClauseExchange(&exchange, k);
+            }
+            s->addReconstruction(bceStack);
+            for (const auto& lits : amo.constraints) {
+                s->addAtMostOne(lits);
+            }
+            // Formel wird geteilt gelesen; jeder Worker erhält seine eigene Kopie, der letzte den Puffer
+            s->loadClauses(k + 1 == configs.size() ? std::move(clauses) : std::vector<Clause>(clauses));
+            solvers.push_back(std::move(s));
+        }
+
+        std::cout << "Solving...\n";
+        auto t_solve_start = std::chrono::high_resolution_clock::now();
+        bool sat = false;
+        const int w = solvePortfolio(solvers, sat);
+        auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+        const PortfolioConfig& cfg = configs[std::max(w, 0)];
+        std::cout << std::string(40, '=') << "\n";
+        std::cout << "Heuristik: " << heuristicName(cfg.heuristic) << "\n";
+        std::cout << "Gewinner: Worker " << w << " (" << heuristicName(cfg.heuristic) << ", "
+                  << restartName(cfg.restart) << ", seed=" << cfg.seed << ")\n";
+        if (sat) {
+            std::cout << "SATISFIABLE\n";
+            solvers[w]->printModel();
+        } else {
+            std::cout << "UNSATISFIABLE\n";
+        }
+        solvers[std::max(w, 0)]->printStats();
+        printRunSummary(cfg.heuristic, cfg.seed, cnfPath, sat, t_solve_end - t_solve_start);
+        solvers[std::max(w, 0)]->exportStats(statsCsvFile);
+        return 0;
+    }
+
     std::cout << std::string(40, '-') << "\n";
     std::cout << "Starte Runs für " << heuristics.size() << " Heuristik(en)\n";
 
@@ -229,16 +1114,56 @@ int main(int argc, char** argv) {
         std::cout << std::string(40, '=') << "\n";
         std::cout << "Heuristik: " << heuristicName(h) << "\n";
 
+        if (useComponents) {
+            std::cout << "Solving...\n";
+            auto t_solve_start = std::chrono::high_resolution_clock::now();
+            std::vector<int> model;
+            Solver summary{0};
+            summary.setHeuristic(h);
+            summary.setParseTime(parseNs);
+            bool sat = solveComponents(split, h, seed, restart, bceStack, summary, model);
+            auto t_solve_end   = std::chrono::high_resolution_clock::now();
+
+            if (sat) {
+                std::cout << "SATISFIABLE\n";
+                printModel(model);
+            } else {
+                std::cout << "UNSATISFIABLE\n";
+            }
+            summary.printStats();
+            printRunSummary(h, seed, cnfPath, sat, t_solve_end - t_solve_start);
+            summary.exportStats(statsCsvFile);
+            continue;
+        }
+
         Solver solver{numVars};
         solver.setHeuristic(h);
         if (seed != 0) {
             solver.setHeuristicSeed(seed);
         }
+        solver.setRestartPolicy(restart);
+        solver.setParseTime(parseNs);
+        solver.addReconstruction(bceStack);
+        for (const auto& lits : amo.constraints) {
+            solver.addAtMostOne(lits);
+        }
 
-        // Klauseln hinzufügen (Zeitmessung optional)
+        // DRAT-Beweis nur für den ersten Run (bei mehreren Heuristiken)
+        ProofWriter proof;
+        if (!proofFile.empty() && &h == &heuristics.front()) {
+            if (!proof.open(proofFile, asyncProof)) {
+                std::cerr << "Fehler: Konnte Beweisdatei nicht anlegen: " << proofFile << "\n";
+                return 1;
+            }
+            solver.setProof(&proof);
+        }
+
+        // Klauseln hinzufügen (Zeitmessung optional): frühere Runs kopieren, der letzte verschiebt
         auto t_add_start = std::chrono::high_resolution_clock::now();
-        for (const auto& c : clauses) {
-            solver.addClause(c);
+        if (&h == &heuristics.back()) {
+            solver.loadClauses(std::move(clauses));
+        } else {
+            solver.loadClauses(std::vector<Clause>(clauses));
         }
         auto t_add_end = std::chrono::high_resolution_clock::now();
         auto add_seconds = std::chrono::duration_cast<std::chrono::seconds>(t_add_end - t_add_start);
@@ -250,10 +1175,13 @@ int main(int argc, char** argv) {
         bool sat = solver.solve();
         auto t_solve_end   = std::chrono::high_resolution_clock::now();
 
-        // Laufzeiten
-        auto dt_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(t_solve_end - t_solve_start);
-        auto dt_s   = std::chrono::duration_cast<std::chrono::seconds>(t_solve_end - t_solve_start);
-        auto dt_min = std::chrono::duration_cast<std::chrono::minutes>(t_solve_end - t_solve_start);
+        if (proof.isOpen()) {
+            if (!proof.close()) {
+                std::cerr << "Fehler: Beweis unvollständig geschrieben: " << proofFile << "\n";
+            } else {
+                std::cout << "DRAT-Beweis: " << proofFile << " (" << proof.bytesWritten() << " Bytes)\n";
+            }
+        }
 
         // Ergebnis + Stats
         if (sat) {
@@ -265,21 +1193,7 @@ int main(int argc, char** argv) {
             solver.printStats();
         }
 
-        // Kompakte Zusammenfassung / gut für Parser (optional erweiterbar)
-        std::cout << std::string(20, '-') << "\n";
-        std::cout << "Laufzeit (" << heuristicName(h) << "):\n"
-                  << " - " << dt_ms.count()  << " ms\n"
-                  << " - " << dt_s.count()   << " seconds\n"
-                  << " - " << dt_min.count() << " minutes\n";
-
-        // Einheitliche RESULT-Zeile (praktisch für CSV-Parser)
-        // time_s = bei UNSAT/SAT reale Zeit in Sekunden
-        std::cout << "RESULT,heuristic=" << heuristicName(h)
-                  << ",seed=" << seed
-                  << ",instance=" << cnfPath
-                  << ",solved=" << (sat ? 1 : 0)
-                  << ",time_s=" << dt_s.count()
-                  << std::endl;
+        printRunSummary(h, seed, cnfPath, sat, t_solve_end - t_solve_start);
 
         solver.exportStats(statsCsvFile);
     }